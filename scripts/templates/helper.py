@@ -1455,6 +1455,16 @@ Public:
 def get_loader_epilogue(specs, namespace, tags, obj, meta):
     epilogue = []
 
+    # Retain and release functions take the handle as their only parameter,
+    # and the loader handle's references follow the adapter handle's
+    lifetime = re.match(r"\w+(Retain|Release)(Command)?(Exp)?$", make_func_name(namespace, tags, obj))
+    if lifetime and len(obj['params']) != 1:
+        lifetime = None
+
+    # Root devices aren't reference counted, retaining or releasing one leaves
+    # its count unchanged, so the loader handles for them are pinned instead
+    pinned = make_func_name(namespace, tags, obj) == "%sDeviceGet" % namespace
+
     for i, item in enumerate(obj['params']):
         if param_traits.is_mbz(item):
             continue
@@ -1465,7 +1475,16 @@ def get_loader_epilogue(specs, namespace, tags, obj, meta):
         obj_name = re.sub(r"(\w+)_handle_t", r"\1_object_t", tname)
         fty_name = re.sub(r"(\w+)_handle_t", r"\1_factory", tname)
 
-        if param_traits.is_release(item) or param_traits.is_output(item) or param_traits.is_inoutput(item):
+        if lifetime and type_traits.is_class_handle(item['type'], meta):
+            epilogue.append({
+                'name': name,
+                'type': tname,
+                'obj': obj_name,
+                'factory': fty_name,
+                'release': lifetime.group(1) == "Release",
+                'retain': lifetime.group(1) == "Retain"
+            })
+        elif param_traits.is_release(item) or param_traits.is_output(item) or param_traits.is_inoutput(item):
             if type_traits.is_class_handle(item['type'], meta):
                 if param_traits.is_range(item):
                     range_start = param_traits.range_start(item)
@@ -1476,6 +1495,7 @@ def get_loader_epilogue(specs, namespace, tags, obj, meta):
                         'obj': obj_name,
                         'factory': fty_name,
                         'release': param_traits.is_release(item),
+                        'pinned': pinned,
                         'range': (range_start, range_end)
                     })
                 else:
@@ -1485,6 +1505,7 @@ def get_loader_epilogue(specs, namespace, tags, obj, meta):
                         'obj': obj_name,
                         'factory': fty_name,
                         'release': param_traits.is_release(item),
+                        'pinned': pinned,
                         'optional': param_traits.is_optional(item)
                     })
             elif param_traits.is_typename(item):
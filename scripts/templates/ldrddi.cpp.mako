@@ -18,6 +18,7 @@ from templates import helper as th
  * @file ${name}.cpp
  *
  */
+#include "${x}_lib.hpp"
 #include "${x}_lib_loader.hpp"
 #include "${x}_loader.hpp"
 
@@ -53,6 +54,9 @@ namespace ur_loader
 
         %if re.match(r"\w+AdapterGet$", th.make_func_name(n, tags, obj)):
         
+        // adapters are loaded here rather than by urLoaderInit when lazy
+        context->loadLazyAdapters();
+
         size_t adapterIndex = 0;
         if( nullptr != ${obj['params'][1]['name']} && ${obj['params'][0]['name']} !=0)
         {
@@ -147,7 +151,7 @@ namespace ur_loader
         <%
         add_local = True
         param_replacements[item['name']] = item['name'] + 'Local.data()'%>// convert loader handles to platform handles
-        auto ${item['name']}Local = std::vector<${item['type']}>(${item['range'][1]});
+        auto ${item['name']}Local = handle_list_t<${item['type']}>(${item['range'][1]});
         for( size_t i = ${item['range'][0]}; i < ${item['range'][1]}; ++i )
             ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
         %else:
@@ -279,7 +283,11 @@ namespace ur_loader
         %if item['release']:
         // release loader handle
         ${item['factory']}.release( ${item['name']} );
+        %elif item.get('retain', False):
+        // retain loader handle
+        ${item['factory']}.retain( ${item['name']} );
         %elif not '_native_object_' in item['obj']:
+        <% get_instance = "getPinnedInstance" if item.get('pinned', False) else "getInstance" %>\
         try
         {
             %if 'typename' in item:
@@ -292,7 +300,7 @@ namespace ur_loader
                             for (size_t i = 0; i < nelements; ++i) {
                                 if (handles[i] != nullptr) {
                                     handles[i] = reinterpret_cast<${etor['type']}>(
-                                        ${etor['factory']}.getInstance( handles[i], dditable ) );
+                                        ${etor['factory']}.getBorrowedInstance( handles[i], dditable ) );
                                 }
                             }
                         } break;
@@ -304,16 +312,16 @@ namespace ur_loader
             // convert platform handles to loader handles
             for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
                 ${item['name']}[ i ] = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( ${item['name']}[ i ], dditable ) );
+                    ${item['factory']}.${get_instance}( ${item['name']}[ i ], dditable ) );
             %else:
             // convert platform handle to loader handle
             %if item['optional']:
             if( nullptr != ${item['name']} )
                 *${item['name']} = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+                    ${item['factory']}.${get_instance}( *${item['name']}, dditable ) );
             %else:
             *${item['name']} = reinterpret_cast<${item['type']}>(
-                ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+                ${item['factory']}.${get_instance}( *${item['name']}, dditable ) );
             %endif
             %endif
         }
@@ -332,6 +340,24 @@ namespace ur_loader
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Fills the DDI tables of an adapter loaded after urLoaderInit,
+    ///        which is the case when adapters are loaded lazily
+    void loadDdiTables( platform_t &platform )
+    {
+        auto handle = platform.handle.get();
+        auto &dditable = platform.dditable.${n};
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+        if( platform.initStatus == ${X}_RESULT_SUCCESS )
+        {
+            auto getTable = reinterpret_cast<${tbl['pfn']}>(
+                LibLoader::getFunctionPtr(handle, "${tbl['export']['name']}"));
+            if( getTable )
+                platform.initStatus = getTable( context->version, &dditable.${tbl['name']} );
+        }
+        %endfor
+    }
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -361,6 +387,15 @@ ${tbl['export']['name']}(
     if( ur_loader::context->version < version )
         return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if( ur_lib::context->dispatchReady.load( std::memory_order_acquire ) )
+    {
+        *pDdiTable = ur_lib::context->${n}DdiTable.${tbl['name']};
+        return ${X}_RESULT_SUCCESS;
+    }
+
     ${x}_result_t result = ${X}_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
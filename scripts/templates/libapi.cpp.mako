@@ -55,7 +55,9 @@ ${th.make_func_name(n, tags, obj)}(
     ${line}
     %endfor
     )
+%if re.match("Init", obj['name']) or th.obj_traits.is_loader_only(obj):
 try {
+%endif
 %if re.match("Init", obj['name']):
     <%
     param_checks=th.make_param_checks(n, tags, obj, meta=meta).items()
@@ -77,13 +79,23 @@ try {
 %elif th.obj_traits.is_loader_only(obj):
     return ur_lib::${th.make_func_name(n, tags, obj)}(${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 %else:
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+{
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::dispatchDdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
         return ${X}_RESULT_ERROR_UNINITIALIZED;
 
-    return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    if( ${x}_lib::directDispatch )
+        return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+    try {
+        return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    } catch(...) { return exceptionToResult(std::current_exception()); }
 %endif
+%if re.match("Init", obj['name']) or th.obj_traits.is_loader_only(obj):
 } catch(...) { return exceptionToResult(std::current_exception()); }
+%else:
+}
+%endif
 %if 'condition' in obj:
 #endif // ${th.subt(n, tags, obj['condition'])}
 %endif
@@ -0,0 +1,315 @@
+//===----------- bulk_memory.hpp - Native CPU Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <tuple>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "parallel_for.hpp"
+
+// Fills and copies of host memory, as used by the memory commands. Large
+// operations are split into pieces that run in parallel on the thread pool,
+// since a single core can't saturate the memory bandwidth.
+
+namespace native_cpu {
+namespace bulk {
+
+// Operations smaller than this run as a single task.
+constexpr size_t parallelThreshold = size_t{1} << 20;
+// Approximate size of the pieces larger operations are split into.
+constexpr size_t chunkSize = size_t{1} << 18;
+// Operations at least this large write with non-temporal stores: their
+// destination doesn't fit in the caches, so there's no point in evicting
+// everything else for it.
+constexpr size_t nonTemporalThreshold = size_t{1} << 25;
+
+namespace detail {
+constexpr size_t blockSize = 64;
+
+inline bool isPowerOf2(size_t x) { return x && !(x & (x - 1)); }
+
+// Writes `count` copies of the 64 bytes at `block` from `out` on.
+inline void storeBlocks(uint8_t *out, const uint8_t *block, size_t count,
+                        bool nonTemporal) {
+#ifdef __SSE2__
+  if (nonTemporal && reinterpret_cast<uintptr_t>(out) % 16 == 0) {
+    const __m128i *src = reinterpret_cast<const __m128i *>(block);
+    const __m128i v0 = _mm_loadu_si128(src);
+    const __m128i v1 = _mm_loadu_si128(src + 1);
+    const __m128i v2 = _mm_loadu_si128(src + 2);
+    const __m128i v3 = _mm_loadu_si128(src + 3);
+    for (size_t i = 0; i < count; i++) {
+      __m128i *dst = reinterpret_cast<__m128i *>(out + i * blockSize);
+      _mm_stream_si128(dst, v0);
+      _mm_stream_si128(dst + 1, v1);
+      _mm_stream_si128(dst + 2, v2);
+      _mm_stream_si128(dst + 3, v3);
+    }
+    _mm_sfence();
+    return;
+  }
+#endif
+  for (size_t i = 0; i < count; i++) {
+    memcpy(out + i * blockSize, block, blockSize);
+  }
+}
+
+// Writes the pattern bytes for the range [begin, end) of a fill whose first
+// byte is the byte `phase` of the pattern.
+inline void fillBytewise(uint8_t *out, const uint8_t *pattern,
+                         size_t patternSize, size_t phase, size_t begin,
+                         size_t end) {
+  for (size_t i = begin; i < end; i++) {
+    out[i] = pattern[(phase + i) % patternSize];
+  }
+}
+} // namespace detail
+
+// Fills `size` bytes at `dst` with copies of the `patternSize` bytes long
+// pattern. The byte written at `dst` is the byte `phase` of the pattern, so
+// that a fill can be split into pieces that don't start on a whole pattern.
+inline void fill(void *dst, const void *pPattern, size_t patternSize,
+                 size_t size, bool nonTemporal, size_t phase = 0) {
+  using detail::blockSize;
+  auto *out = static_cast<uint8_t *>(dst);
+  const auto *pattern = static_cast<const uint8_t *>(pPattern);
+  phase %= patternSize;
+  if (patternSize == 1 && !nonTemporal) {
+    memset(out, *pattern, size);
+    return;
+  }
+
+  if (detail::isPowerOf2(patternSize) && patternSize <= blockSize) {
+    // Broadcast the pattern into a block, and store the block with wide
+    // stores from the first block aligned address on.
+    const size_t head =
+        std::min(size, -reinterpret_cast<uintptr_t>(out) % blockSize);
+    detail::fillBytewise(out, pattern, patternSize, phase, 0, head);
+    alignas(blockSize) uint8_t block[blockSize];
+    for (size_t i = 0; i < blockSize; i++) {
+      block[i] = pattern[(phase + head + i) % patternSize];
+    }
+    const size_t numBlocks = (size - head) / blockSize;
+    detail::storeBlocks(out + head, block, numBlocks, nonTemporal);
+    const size_t tail = head + numBlocks * blockSize;
+    detail::fillBytewise(out, pattern, patternSize, phase, tail, size);
+    return;
+  }
+
+  // Write the pattern once, then keep doubling the filled prefix. The source
+  // of the copies is capped to stay in the cache.
+  const size_t first = std::min(size, patternSize);
+  const size_t firstPart = std::min(first, patternSize - phase);
+  memcpy(out, pattern + phase, firstPart);
+  memcpy(out + firstPart, pattern, first - firstPart);
+  const size_t maxSource = std::max<size_t>(
+      patternSize, (size_t{1} << 16) / patternSize * patternSize);
+  size_t filled = first;
+  while (filled < size) {
+    const size_t n = std::min({filled, maxSource, size - filled});
+    memcpy(out + filled, out, n);
+    filled += n;
+  }
+}
+
+// Copies `size` bytes between non-overlapping ranges.
+inline void copy(void *dst, const void *src, size_t size, bool nonTemporal) {
+#ifdef __SSE2__
+  if (nonTemporal && size >= 4 * detail::blockSize) {
+    auto *out = static_cast<uint8_t *>(dst);
+    const auto *in = static_cast<const uint8_t *>(src);
+    const size_t head = -reinterpret_cast<uintptr_t>(out) % 16;
+    memcpy(out, in, head);
+    size_t i = head;
+    for (; i + detail::blockSize <= size; i += detail::blockSize) {
+      const __m128i *s = reinterpret_cast<const __m128i *>(in + i);
+      __m128i *d = reinterpret_cast<__m128i *>(out + i);
+      const __m128i v0 = _mm_loadu_si128(s);
+      const __m128i v1 = _mm_loadu_si128(s + 1);
+      const __m128i v2 = _mm_loadu_si128(s + 2);
+      const __m128i v3 = _mm_loadu_si128(s + 3);
+      _mm_stream_si128(d, v0);
+      _mm_stream_si128(d + 1, v1);
+      _mm_stream_si128(d + 2, v2);
+      _mm_stream_si128(d + 3, v3);
+    }
+    _mm_sfence();
+    memcpy(out + i, in + i, size - i);
+    return;
+  }
+#endif
+  std::ignore = nonTemporal;
+  memcpy(dst, src, size);
+}
+
+// Size of the pieces a fill with the given pattern is split into: about
+// chunkSize, and a whole number of patterns so that every piece starts with
+// the first byte of the pattern.
+inline size_t fillGranule(size_t patternSize) {
+  return std::max<size_t>(1, chunkSize / patternSize) * patternSize;
+}
+
+// Runs `op(begin, end)` over pieces of [0, size) on the thread pool, the
+// pieces being `granule` bytes long but for the last one, then calls
+// `done()`. Operations below parallelThreshold are a single piece. Does not
+// block.
+template <typename ThreadPoolT, typename OpT, typename DoneT>
+void parallelRanges(ThreadPoolT &tp, size_t size, size_t granule, OpT &&op,
+                    DoneT &&done) {
+  const size_t numPieces =
+      size < parallelThreshold ? 1 : (size + granule - 1) / granule;
+  parallel_for_chunks(
+      tp, numPieces,
+      [op = std::forward<OpT>(op), size, granule,
+       numPieces](size_t, size_t begin, size_t end) {
+        if (numPieces == 1) {
+          op(size_t{0}, size);
+          return;
+        }
+        op(begin * granule, std::min(end * granule, size));
+      },
+      std::forward<DoneT>(done));
+}
+
+// Pages are touched at this granularity by firstTouch.
+constexpr size_t pageSize = size_t{1} << 12;
+
+// Writes to every page that lies entirely within [ptr, ptr + size) from the
+// workers of the thread pool, splitting the pages between the NUMA nodes the
+// way kernel launches split their work-groups. The pages are thus placed on
+// the nodes that will use them, rather than on the node of the allocating
+// thread. The contents of those pages are clobbered. Only does anything when
+// the workers are spread over several nodes, and blocks until done.
+template <typename ThreadPoolT>
+void firstTouch(ThreadPoolT &tp, void *ptr, size_t size) {
+  if (tp.placement().num_nodes() <= 1 || size < parallelThreshold) {
+    return;
+  }
+  const auto begin = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t firstPage = (begin + pageSize - 1) / pageSize;
+  const uintptr_t lastPage = (begin + size) / pageSize;
+  if (lastPage <= firstPage) {
+    return;
+  }
+  std::promise<void> touched;
+  parallel_for_chunks(
+      tp, lastPage - firstPage,
+      [firstPage](size_t, size_t pageBegin, size_t pageEnd) {
+        for (size_t page = pageBegin; page < pageEnd; page++) {
+          *reinterpret_cast<volatile uint8_t *>((firstPage + page) *
+                                                pageSize) = 0;
+        }
+      },
+      [&touched]() { touched.set_value(); });
+  touched.get_future().wait();
+}
+
+// A region of `numRows` rows of `rowSize` contiguous bytes in each of
+// `numSlices` slices, as laid out in the destination and the source of a
+// rect copy. Fills only use the destination pitches.
+struct strided_region_t {
+  size_t rowSize;
+  size_t numRows;
+  size_t numSlices;
+  size_t dstRowPitch;
+  size_t dstSlicePitch;
+  size_t srcRowPitch;
+  size_t srcSlicePitch;
+
+  // Merges the rows, and then the slices, that are contiguous in both the
+  // destination and the source, so that they're handled as a single row.
+  // A region that is contiguous as a whole becomes a single row.
+  void collapse() {
+    if (numRows == 1) {
+      numRows = numSlices;
+      numSlices = 1;
+      dstRowPitch = dstSlicePitch;
+      srcRowPitch = srcSlicePitch;
+    }
+    if (numRows > 1 && dstRowPitch == rowSize && srcRowPitch == rowSize) {
+      rowSize *= numRows;
+      numRows = numSlices;
+      numSlices = 1;
+      dstRowPitch = dstSlicePitch;
+      srcRowPitch = srcSlicePitch;
+      if (numRows > 1 && dstRowPitch == rowSize && srcRowPitch == rowSize) {
+        rowSize *= numRows;
+        numRows = 1;
+      }
+    }
+  }
+
+  size_t numTotalRows() const { return numRows * numSlices; }
+  size_t size() const { return rowSize * numTotalRows(); }
+
+  // Offsets of a row, numbered across the slices, in the destination and in
+  // the source.
+  size_t dstOffset(size_t row) const {
+    return row / numRows * dstSlicePitch + row % numRows * dstRowPitch;
+  }
+  size_t srcOffset(size_t row) const {
+    return row / numRows * srcSlicePitch + row % numRows * srcRowPitch;
+  }
+};
+
+// Runs `op(row, begin, end)` over the bytes [begin, end) of the rows of the
+// region on the thread pool, then calls `done()`. Small rows are grouped into
+// pieces of about chunkSize bytes, rows larger than that are split into pieces
+// `granule` bytes long but for the last one. Regions below parallelThreshold
+// are a single piece. Does not block.
+template <typename ThreadPoolT, typename OpT, typename DoneT>
+void parallelRows(ThreadPoolT &tp, const strided_region_t &region,
+                  size_t granule, OpT &&op, DoneT &&done) {
+  const size_t numRows = region.numTotalRows();
+  const size_t rowSize = region.rowSize;
+  size_t rowsPerPiece = std::max<size_t>(numRows, 1);
+  size_t piecesPerRow = 1;
+  if (region.size() >= parallelThreshold) {
+    if (rowSize > chunkSize) {
+      rowsPerPiece = 1;
+      piecesPerRow = (rowSize + granule - 1) / granule;
+    } else {
+      rowsPerPiece = chunkSize / rowSize;
+    }
+  }
+  const size_t numPieces =
+      (numRows + rowsPerPiece - 1) / rowsPerPiece * piecesPerRow;
+  parallel_for_chunks(
+      tp, numPieces,
+      [op = std::forward<OpT>(op), numRows, rowSize, granule, rowsPerPiece,
+       piecesPerRow](size_t, size_t begin, size_t end) {
+        for (size_t piece = begin; piece < end; piece++) {
+          if (piecesPerRow > 1) {
+            const size_t part = piece % piecesPerRow;
+            op(piece / piecesPerRow, part * granule,
+               std::min((part + 1) * granule, rowSize));
+            continue;
+          }
+          const size_t lastRow =
+              std::min((piece + 1) * rowsPerPiece, numRows);
+          for (size_t row = piece * rowsPerPiece; row < lastRow; row++) {
+            op(row, size_t{0}, rowSize);
+          }
+        }
+      },
+      std::forward<DoneT>(done));
+}
+
+} // namespace bulk
+} // namespace native_cpu
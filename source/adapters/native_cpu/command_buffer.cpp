@@ -8,186 +8,674 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "command_buffer.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "device.hpp"
+#include "enqueue.hpp"
+#include "memory.hpp"
+#include "parallel_for.hpp"
+#include "queue.hpp"
+
+/// Command-buffers are recorded as a graph of commands. Kernel commands are
+/// partitioned for the thread pool and have their arguments captured when they
+/// are appended, and finalizing the command-buffer computes the order in which
+/// the commands are started. An enqueue is then a single command on the queue
+/// which walks the graph, so replaying a command-buffer does not go through
+/// the queue for each of its commands.
+
+// State of one execution of a command-buffer. Several executions of the same
+// command-buffer may be in flight at once. Owns an internal reference to the
+// command-buffer, which is taken when the execution is enqueued.
+struct ur_exp_command_buffer_handle_t_::execution_t {
+  execution_t(ur_exp_command_buffer_handle_t hCommandBuffer,
+              native_cpu::threadpool_t &tp, ur_event_handle_t hEvent)
+      : hCommandBuffer(hCommandBuffer), tp(tp), hEvent(hEvent),
+        numPendingPredecessors(
+            new std::atomic<uint32_t>[hCommandBuffer->nodes.size()]),
+        latch(hCommandBuffer->nodes.size() + 1) {
+    auto &nodes = hCommandBuffer->nodes;
+    for (size_t i = 0; i < nodes.size(); i++) {
+      numPendingPredecessors[i].store(nodes[i].numPredecessors,
+                                      std::memory_order_relaxed);
+    }
+    // Launches of an updatable command-buffer may be replaced while this
+    // execution runs, so it keeps the launches it started with alive.
+    if (hCommandBuffer->isUpdatable) {
+      std::lock_guard<std::mutex> lock(hCommandBuffer->mutex);
+      launches.reserve(nodes.size());
+      for (auto &node : nodes) {
+        launches.push_back(node.launch);
+      }
+    }
+  }
+
+  ~execution_t() { hCommandBuffer->releaseInternal(); }
+
+  const native_cpu::kernel_launch_t *
+  launch(ur_exp_command_buffer_sync_point_t node) const {
+    return launches.empty() ? hCommandBuffer->nodes[node].launch.get()
+                            : launches[node].get();
+  }
+
+  ur_exp_command_buffer_handle_t const hCommandBuffer;
+  native_cpu::threadpool_t &tp;
+  ur_event_handle_t const hEvent;
+  std::unique_ptr<std::atomic<uint32_t>[]> numPendingPredecessors;
+  // Counts the commands, plus one for the thread starting the execution
+  native_cpu::completion_latch_t latch;
+  std::vector<std::shared_ptr<const native_cpu::kernel_launch_t>> launches;
+};
+
+ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice, bool isUpdatable,
+    bool isInOrder)
+    : hContext(hContext), hDevice(hDevice), isUpdatable(isUpdatable),
+      isInOrder(isInOrder) {
+  hContext->incrementReferenceCount();
+}
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  for (auto &node : nodes) {
+    for (auto hMem : node.memObjects) {
+      urMemRelease(hMem);
+    }
+  }
+  decrementOrDelete(hContext);
+}
+
+void ur_exp_command_buffer_handle_t_::release() {
+  if (decrementReferenceCount() > 0) {
+    return;
+  }
+  // The commands may hold the last internal references, so the one of the
+  // user is dropped only after them.
+  for (auto hCommand : commandHandles) {
+    decrementOrDelete(hCommand);
+  }
+  commandHandles.clear();
+  releaseInternal();
+}
+
+void ur_exp_command_buffer_handle_t_::releaseInternal() {
+  if (--internalRefCount == 0) {
+    delete this;
+  }
+}
+
+ur_exp_command_buffer_command_handle_t_::
+    ur_exp_command_buffer_command_handle_t_(
+        ur_exp_command_buffer_handle_t hCommandBuffer,
+        ur_exp_command_buffer_sync_point_t node, ur_kernel_handle_t hKernel,
+        const native_cpu::NDRDescT &ndr, bool hasLocalSize)
+    : hCommandBuffer(hCommandBuffer), node(node), hKernel(hKernel), ndr(ndr),
+      hasLocalSize(hasLocalSize), argList(hKernel->getArgList()) {
+  hCommandBuffer->incrementInternalReferenceCount();
+}
+
+ur_exp_command_buffer_command_handle_t_::
+    ~ur_exp_command_buffer_command_handle_t_() {
+  hCommandBuffer->releaseInternal();
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::appendNode(
+    native_cpu::cb_node_t &&node, uint32_t numSyncPoints,
+    const ur_exp_command_buffer_sync_point_t *pSyncPoints,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(!isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT((numSyncPoints == 0) == (pSyncPoints == nullptr),
+            UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP);
+
+  const auto syncPoint =
+      static_cast<ur_exp_command_buffer_sync_point_t>(nodes.size());
+  for (uint32_t i = 0; i < numSyncPoints; i++) {
+    UR_ASSERT(pSyncPoints[i] < syncPoint,
+              UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_EXP);
+  }
+  node.deps.assign(pSyncPoints, pSyncPoints + numSyncPoints);
+  if (isInOrder && syncPoint > 0) {
+    node.deps.push_back(syncPoint - 1);
+  }
+  nodes.push_back(std::move(node));
+  for (auto hMem : nodes.back().memObjects) {
+    hMem->incrementRefCount();
+  }
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::appendHostFn(
+    std::function<void()> &&fn, uint32_t numSyncPoints,
+    const ur_exp_command_buffer_sync_point_t *pSyncPoints,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    std::initializer_list<ur_mem_handle_t> memObjects) {
+  native_cpu::cb_node_t node;
+  node.hostFn = std::move(fn);
+  node.memObjects = memObjects;
+  return appendNode(std::move(node), numSyncPoints, pSyncPoints, pSyncPoint);
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::finalize() {
+  UR_ASSERT(!isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  for (ur_exp_command_buffer_sync_point_t i = 0; i < nodes.size(); i++) {
+    auto &deps = nodes[i].deps;
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+    nodes[i].numPredecessors = static_cast<uint32_t>(deps.size());
+    if (deps.empty()) {
+      roots.push_back(i);
+    }
+    for (auto dep : deps) {
+      nodes[dep].successors.push_back(i);
+    }
+  }
+  isFinalized = true;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::enqueue(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  auto &tp = hQueue->device->tp;
+  // Keeps the command-buffer alive until the execution has completed
+  incrementInternalReferenceCount();
+  auto Result = hQueue->enqueueCommand(
+      UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent, [this, &tp](ur_event_handle_t hEvent) {
+        hEvent->setRunning();
+        auto exec = new execution_t(this, tp, hEvent);
+        for (auto root : roots) {
+          runNode(exec, root);
+        }
+        countDown(exec);
+      });
+  if (Result != UR_RESULT_SUCCESS) {
+    releaseInternal();
+  }
+  return Result;
+}
+
+void ur_exp_command_buffer_handle_t_::updateLaunch(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  auto launch = std::make_shared<const native_cpu::kernel_launch_t>(
+      hCommand->hKernel, hCommand->argList.capture(), hCommand->ndr,
+      hDevice->tp.num_threads());
+  std::lock_guard<std::mutex> lock(mutex);
+  nodes[hCommand->node].launch = std::move(launch);
+}
+
+void ur_exp_command_buffer_handle_t_::runNode(
+    execution_t *exec, ur_exp_command_buffer_sync_point_t node) {
+  if (auto launch = exec->launch(node)) {
+    native_cpu::parallel_for_chunks(
+        exec->tp, launch->numUnits(),
+        [exec, launch](size_t threadId, size_t begin, size_t end) {
+          launch->run(launch->threadArgs(exec->tp, threadId), begin, end);
+        },
+        [exec, node]() { nodeCompleted(exec, node); });
+  } else if (exec->hCommandBuffer->nodes[node].hostFn) {
+    exec->tp.schedule([exec, node](size_t) {
+      exec->hCommandBuffer->nodes[node].hostFn();
+      nodeCompleted(exec, node);
+    });
+  } else {
+    nodeCompleted(exec, node);
+  }
+}
 
-/// Stub implementations of UR experimental feature command-buffers
-/// Taken almost unchanged from another adapter. Perhaps going forward
-/// these stubs could be defined in core UR as the default which would
-/// reduce code duplication. Adapters could then "override" these defaults.
-/// Issue raised for this comment in
-/// https://github.com/oneapi-src/unified-runtime/issues/1064
+void ur_exp_command_buffer_handle_t_::nodeCompleted(
+    execution_t *exec, ur_exp_command_buffer_sync_point_t node) {
+  for (auto successor : exec->hCommandBuffer->nodes[node].successors) {
+    if (exec->numPendingPredecessors[successor].fetch_sub(
+            1, std::memory_order_acq_rel) == 1) {
+      runNode(exec, successor);
+    }
+  }
+  countDown(exec);
+}
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t, ur_device_handle_t,
-    const ur_exp_command_buffer_desc_t *, ur_exp_command_buffer_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::countDown(execution_t *exec) {
+  if (exec->latch.count_down()) {
+    auto hEvent = exec->hEvent;
+    delete exec;
+    hEvent->complete();
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const bool isUpdatable =
+      pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
+  const bool isInOrder =
+      pCommandBufferDesc ? pCommandBufferDesc->isInOrder : false;
+  *phCommandBuffer = new ur_exp_command_buffer_handle_t_(hContext, hDevice,
+                                                         isUpdatable, isInOrder);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hCommandBuffer->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hCommandBuffer->release();
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  return hCommandBuffer->finalize();
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
-    ur_exp_command_buffer_handle_t, ur_kernel_handle_t, uint32_t,
-    const size_t *, const size_t *, const size_t *, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pGlobalWorkSize, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  if (auto Err =
+          native_cpu::checkReqdWGSize(hKernel, workDim, pLocalWorkSize)) {
+    return Err;
+  }
+
+  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  native_cpu::cb_node_t node;
+  node.launch = std::make_shared<const native_cpu::kernel_launch_t>(
+      hKernel, hKernel->captureArgs(), ndr,
+      hCommandBuffer->hDevice->tp.num_threads());
+
+  ur_exp_command_buffer_sync_point_t syncPoint;
+  if (auto Err = hCommandBuffer->appendNode(std::move(node),
+                                            numSyncPointsInWaitList,
+                                            pSyncPointWaitList, &syncPoint)) {
+    return Err;
+  }
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+
+  // Commands of a command-buffer that isn't updatable still get a handle, on
+  // which updates fail.
+  auto hCommand = new ur_exp_command_buffer_command_handle_t_(
+      hCommandBuffer, syncPoint, hKernel, ndr, pLocalWorkSize != nullptr);
+  hCommandBuffer->commandHandles.push_back(hCommand);
+  if (phCommand) {
+    hCommand->incrementReferenceCount();
+    *phCommand = hCommand;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return hCommandBuffer->appendHostFn(
+      [pDst, pSrc, size]() { memcpy(pDst, pSrc, size); },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hSrcMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDstMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  const char *SrcPtr = hSrcMem->_mem + srcOffset;
+  char *DstPtr = hDstMem->_mem + dstOffset;
+  return hCommandBuffer->appendHostFn(
+      [DstPtr, SrcPtr, size]() {
+        if (SrcPtr != DstPtr && size)
+          memmove(DstPtr, SrcPtr, size);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint,
+      {hSrcMem, hDstMem});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t,
-    ur_rect_offset_t, ur_rect_offset_t, ur_rect_region_t, size_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
+    ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
+    size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hSrcMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDstMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  return hCommandBuffer->appendHostFn(
+      [pDst = hDstMem->_mem, pSrc = hSrcMem->_mem, dstOrigin, srcOrigin,
+       region, dstRowPitch, dstSlicePitch, srcRowPitch, srcSlicePitch]() {
+        native_cpu::copyRect(pDst, pSrc, dstOrigin, srcOrigin, region,
+                             dstRowPitch, dstSlicePitch, srcRowPitch,
+                             srcSlicePitch);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint,
+      {hSrcMem, hDstMem});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t,
-    const void *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  char *DstPtr = hBuffer->_mem + offset;
+  return hCommandBuffer->appendHostFn(
+      [DstPtr, pSrc, size]() { memcpy(DstPtr, pSrc, size); },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  const char *SrcPtr = hBuffer->_mem + offset;
+  return hCommandBuffer->appendHostFn(
+      [pDst, SrcPtr, size]() { memcpy(pDst, SrcPtr, size); },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return hCommandBuffer->appendHostFn(
+      [pDst = hBuffer->_mem, pSrc, bufferOffset, hostOffset, region,
+       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch]() {
+        native_cpu::copyRect(pDst, pSrc, bufferOffset, hostOffset, region,
+                             bufferRowPitch, bufferSlicePitch, hostRowPitch,
+                             hostSlicePitch);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, {hBuffer});
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return hCommandBuffer->appendHostFn(
+      [pDst, pSrc = hBuffer->_mem, bufferOffset, hostOffset, region,
+       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch]() {
+        native_cpu::copyRect(pDst, pSrc, hostOffset, bufferOffset, region,
+                             hostRowPitch, hostSlicePitch, bufferRowPitch,
+                             bufferSlicePitch);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
-    ur_exp_command_buffer_handle_t, ur_queue_handle_t, uint32_t,
-    const ur_event_handle_t *, ur_event_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  return hCommandBuffer->enqueue(hQueue, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, const void *, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  std::vector<uint8_t> pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   patternSize);
+  char *ptr = hBuffer->_mem + offset;
+  return hCommandBuffer->appendHostFn(
+      [ptr, pattern = std::move(pattern), size]() {
+        native_cpu::fillUSM(ptr, pattern.size(), pattern.data(), size);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, {hBuffer});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, size_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pMemory, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize > 0 && size % patternSize == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  std::vector<uint8_t> pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   patternSize);
+  return hCommandBuffer->appendHostFn(
+      [pMemory, pattern = std::move(pattern), size]() {
+        native_cpu::fillUSM(pMemory, pattern.size(), pattern.data(), size);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t,
-    ur_usm_migration_flags_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = flags;
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // USM memory is host memory, the command only orders the commands around
+  // it.
+  return hCommandBuffer->appendNode({}, numSyncPointsInWaitList,
+                                    pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t, ur_usm_advice_flags_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = advice;
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  return hCommandBuffer->appendNode({}, numSyncPointsInWaitList,
+                                    pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferRetainCommandExp(ur_exp_command_buffer_command_handle_t hCommand) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hCommand->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferReleaseCommandExp(ur_exp_command_buffer_command_handle_t hCommand) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  decrementOrDelete(hCommand);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
-    ur_exp_command_buffer_command_handle_t,
-    const ur_exp_command_buffer_update_kernel_launch_desc_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pUpdateKernelLaunch, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT(hCommandBuffer->isUpdatable, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  const uint32_t newWorkDim = pUpdateKernelLaunch->newWorkDim;
+  if (newWorkDim) {
+    UR_ASSERT(newWorkDim == hCommand->ndr.WorkDim,
+              UR_RESULT_ERROR_INVALID_OPERATION);
+    // A local size can only be given together with a global size, and must
+    // be given if and only if the command was created with one.
+    UR_ASSERT(!pUpdateKernelLaunch->pNewLocalWorkSize ||
+                  pUpdateKernelLaunch->pNewGlobalWorkSize,
+              UR_RESULT_ERROR_INVALID_OPERATION);
+    UR_ASSERT((pUpdateKernelLaunch->pNewLocalWorkSize != nullptr) ==
+                  hCommand->hasLocalSize,
+              UR_RESULT_ERROR_INVALID_OPERATION);
+    if (auto Err = native_cpu::checkReqdWGSize(
+            hCommand->hKernel, newWorkDim,
+            pUpdateKernelLaunch->pNewLocalWorkSize)) {
+      return Err;
+    }
+  }
+
+  auto &argList = hCommand->argList;
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewMemObjArgs; i++) {
+    const auto &desc = pUpdateKernelLaunch->pNewMemObjArgList[i];
+    argList.setArgPointer(desc.argIndex,
+                          desc.hNewMemObjArg ? desc.hNewMemObjArg->_mem
+                                             : nullptr);
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewPointerArgs; i++) {
+    const auto &desc = pUpdateKernelLaunch->pNewPointerArgList[i];
+    // The descriptor holds a pointer to the USM pointer
+    void *ptr = nullptr;
+    if (desc.pNewPointerArg) {
+      std::memcpy(&ptr, desc.pNewPointerArg, sizeof(ptr));
+    }
+    argList.setArgPointer(desc.argIndex, ptr);
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewValueArgs; i++) {
+    const auto &desc = pUpdateKernelLaunch->pNewValueArgList[i];
+    argList.setArgValue(desc.argIndex, desc.argSize, desc.pNewValueArg);
+  }
+
+  auto &ndr = hCommand->ndr;
+  for (uint32_t I = 0; I < newWorkDim; I++) {
+    if (pUpdateKernelLaunch->pNewGlobalWorkOffset) {
+      ndr.GlobalOffset[I] = pUpdateKernelLaunch->pNewGlobalWorkOffset[I];
+    }
+    if (pUpdateKernelLaunch->pNewGlobalWorkSize) {
+      ndr.GlobalSize[I] = pUpdateKernelLaunch->pNewGlobalWorkSize[I];
+    }
+    if (pUpdateKernelLaunch->pNewLocalWorkSize) {
+      ndr.LocalSize[I] = pUpdateKernelLaunch->pNewLocalWorkSize[I];
+    }
+  }
+
+  hCommandBuffer->updateLaunch(hCommand);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t, ur_exp_command_buffer_info_t, size_t,
-    void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommandBuffer->getReferenceCount()});
+  default:
+    break;
+  }
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
-    ur_exp_command_buffer_command_handle_t,
-    ur_exp_command_buffer_command_info_t, size_t, void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  UR_ASSERT(hCommand, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommand->getReferenceCount()});
+  default:
+    break;
+  }
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
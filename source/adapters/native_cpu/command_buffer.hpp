@@ -0,0 +1,137 @@
+//===--------- command_buffer.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common.hpp"
+#include "enqueue.hpp"
+#include "kernel.hpp"
+#include "ur_api.h"
+
+namespace native_cpu {
+// A command recorded in a command-buffer. Kernel commands hold a launch that
+// was partitioned when the command was appended, other commands a host
+// function. Commands with neither, such as prefetches, only order the
+// commands around them.
+struct cb_node_t {
+  std::shared_ptr<const kernel_launch_t> launch;
+  std::function<void()> hostFn;
+  std::vector<ur_exp_command_buffer_sync_point_t> deps;
+  // Memory objects accessed by the command, retained by the command-buffer
+  std::vector<ur_mem_handle_t> memObjects;
+  // Computed when the command-buffer is finalized
+  std::vector<ur_exp_command_buffer_sync_point_t> successors;
+  uint32_t numPredecessors = 0;
+};
+} // namespace native_cpu
+
+// Handle to a kernel command, which allows updating the launch after the
+// command-buffer has been finalized. The command-buffer holds a reference to
+// each of its commands until the user has released it, and each command holds
+// an internal reference to its command-buffer.
+struct ur_exp_command_buffer_command_handle_t_ : RefCounted {
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t hCommandBuffer,
+      ur_exp_command_buffer_sync_point_t node, ur_kernel_handle_t hKernel,
+      const native_cpu::NDRDescT &ndr, bool hasLocalSize);
+
+  ~ur_exp_command_buffer_command_handle_t_();
+
+  ur_exp_command_buffer_handle_t const hCommandBuffer;
+  const ur_exp_command_buffer_sync_point_t node;
+  ur_kernel_handle_t const hKernel;
+  native_cpu::NDRDescT ndr;
+  const bool hasLocalSize;
+  // Arguments of the command, initialized from the kernel's arguments when
+  // the command was appended.
+  native_cpu::kernel_arg_list_t argList;
+};
+
+struct ur_exp_command_buffer_handle_t_ : RefCounted {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice, bool isUpdatable,
+                                  bool isInOrder);
+
+  // Drops a reference held by the user. Once the last of them is gone the
+  // command-buffer releases its commands, and it is deleted once the internal
+  // references are gone as well.
+  void release();
+
+  // Internal references are held by command handles and running executions.
+  // They are not reported as the reference count of the command-buffer.
+  void incrementInternalReferenceCount() { ++internalRefCount; }
+  void releaseInternal();
+
+  // Records a command that runs after the commands in the wait list, and
+  // after the previous command if the command-buffer is in-order.
+  ur_result_t appendNode(native_cpu::cb_node_t &&node, uint32_t numSyncPoints,
+                         const ur_exp_command_buffer_sync_point_t *pSyncPoints,
+                         ur_exp_command_buffer_sync_point_t *pSyncPoint);
+
+  // Convenience wrapper around appendNode for commands that consist of a
+  // single host function, which accesses the memory objects `memObjects`.
+  ur_result_t
+  appendHostFn(std::function<void()> &&fn, uint32_t numSyncPoints,
+               const ur_exp_command_buffer_sync_point_t *pSyncPoints,
+               ur_exp_command_buffer_sync_point_t *pSyncPoint,
+               std::initializer_list<ur_mem_handle_t> memObjects = {});
+
+  // Computes the execution order of the commands.
+  ur_result_t finalize();
+
+  // Enqueues an execution of the recorded commands as a single command.
+  ur_result_t enqueue(ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent);
+
+  // Replaces the launch of a kernel command with one built from the
+  // command's current arguments and ND-range. Executions that are already
+  // running keep using the previous launch.
+  void updateLaunch(ur_exp_command_buffer_command_handle_t hCommand);
+
+  ur_context_handle_t const hContext;
+  ur_device_handle_t const hDevice;
+  const bool isUpdatable;
+  const bool isInOrder;
+  bool isFinalized = false;
+
+  // Kernel command handles, each holding one reference owned by the
+  // command-buffer until the user releases it.
+  std::vector<ur_exp_command_buffer_command_handle_t> commandHandles;
+
+private:
+  struct execution_t;
+
+  // Only deleted by releaseInternal()
+  ~ur_exp_command_buffer_handle_t_();
+
+  // Starts the command `node` of an execution, and the commands that depend
+  // on it once it has completed.
+  static void runNode(execution_t *exec, ur_exp_command_buffer_sync_point_t node);
+  static void nodeCompleted(execution_t *exec,
+                            ur_exp_command_buffer_sync_point_t node);
+  // Completes the execution once all its commands have completed.
+  static void countDown(execution_t *exec);
+
+  std::vector<native_cpu::cb_node_t> nodes;
+  // Commands without dependencies, where each execution starts
+  std::vector<ur_exp_command_buffer_sync_point_t> roots;
+  // Protects the launches of the nodes against updates while an execution
+  // takes a snapshot of them.
+  std::mutex mutex;
+  // One for all the references held by the user, plus the internal ones
+  std::atomic_uint32_t internalRefCount{1};
+};
@@ -10,6 +10,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
 #include "logger/ur_logger.hpp"
 #include "ur/ur.hpp"
 
@@ -70,3 +75,28 @@ template <typename T> inline void decrementOrDelete(T *refC) {
   if (refC->decrementReferenceCount() == 0)
     delete refC;
 }
+
+namespace native_cpu {
+// Nanoseconds on the steady clock, used for both the device and the host
+// timestamps and for event profiling.
+inline uint64_t get_timestamp() noexcept {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Resolution of get_timestamp() in nanoseconds.
+inline size_t get_timer_resolution() noexcept {
+#ifdef __linux__
+  // steady_clock reads CLOCK_MONOTONIC, which may tick coarser than the
+  // nanosecond period of the clock
+  timespec Res{};
+  if (clock_getres(CLOCK_MONOTONIC, &Res) == 0) {
+    return std::max<size_t>(Res.tv_sec * 1000000000 + Res.tv_nsec, 1);
+  }
+#endif
+  using namespace std::chrono;
+  return std::max<size_t>(
+      duration_cast<nanoseconds>(steady_clock::duration(1)).count(), 1);
+}
+} // namespace native_cpu
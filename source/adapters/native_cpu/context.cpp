@@ -26,6 +26,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
 
   // TODO: Proper error checking.
   auto ctx = new ur_context_handle_t_(*phDevices);
+#ifdef UMF_ENABLE_POOL_TRACKING
+  if (auto Err = ctx->initDefaultPool()) {
+    delete ctx;
+    return Err;
+  }
+#endif
   *phContext = ctx;
   return UR_RESULT_SUCCESS;
 }
@@ -55,11 +61,8 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   case UR_CONTEXT_INFO_REFERENCE_COUNT:
     return returnValue(uint32_t{hContext->getReferenceCount()});
   case UR_CONTEXT_INFO_USM_MEMCPY2D_SUPPORT:
-    return returnValue(true);
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
-    // case UR_CONTEXT_INFO_USM_MEMSET2D_SUPPORT:
-    // 2D USM operations currently not supported.
-    return returnValue(false);
+    return returnValue(true);
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_ORDER_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_SCOPE_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_FENCE_ORDER_CAPABILITIES:
@@ -10,13 +10,63 @@
 
 #pragma once
 
+#include <mutex>
+#include <set>
+
 #include <ur_api.h>
 
 #include "common.hpp"
 #include "device.hpp"
+#include "usm.hpp"
+#include "virtual_mem.hpp"
 
 struct ur_context_handle_t_ : RefCounted {
   ur_context_handle_t_(ur_device_handle_t_ *phDevices) : _device{phDevices} {}
 
+  ~ur_context_handle_t_() {
+    if (_defaultPool) {
+      decrementOrDelete(_defaultPool);
+    }
+  }
+
+  // Creates the pool serving USM allocations made without a pool handle.
+  ur_result_t initDefaultPool() {
+    auto *Pool = new ur_usm_pool_handle_t_(this, nullptr);
+    if (auto Err = Pool->init()) {
+      delete Pool;
+      return Err;
+    }
+    _defaultPool = Pool;
+    return UR_RESULT_SUCCESS;
+  }
+
+  void addPool(ur_usm_pool_handle_t hPool) {
+    std::lock_guard<std::mutex> Lock(_poolsMutex);
+    _pools.insert(hPool);
+  }
+
+  void removePool(ur_usm_pool_handle_t hPool) {
+    std::lock_guard<std::mutex> Lock(_poolsMutex);
+    _pools.erase(hPool);
+  }
+
+  // Returns the user-created pool owning `hUMFPool`, or nullptr.
+  ur_usm_pool_handle_t getOwningURPool(umf_memory_pool_handle_t hUMFPool) {
+    std::lock_guard<std::mutex> Lock(_poolsMutex);
+    for (auto hPool : _pools) {
+      if (hPool->hasUMFPool(hUMFPool)) {
+        return hPool;
+      }
+    }
+    return nullptr;
+  }
+
   ur_device_handle_t _device;
+  ur_usm_pool_handle_t _defaultPool = nullptr;
+  native_cpu::usm_alloc_map_t _usmAllocs;
+  native_cpu::virtual_mem_access_map_t _virtualMemAccess;
+
+private:
+  std::mutex _poolsMutex;
+  std::set<ur_usm_pool_handle_t> _pools;
 };
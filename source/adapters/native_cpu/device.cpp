@@ -12,6 +12,204 @@
 
 #include "platform.hpp"
 
+#include <algorithm>
+#include <memory>
+
+// Number of compute units in `Units`.
+static size_t countUnits(const std::vector<native_cpu::numa_node_t> &Units) {
+  size_t Count = 0;
+  for (const auto &Node : Units) {
+    Count += Node.cpus.size();
+  }
+  return Count;
+}
+
+// The compute units [Begin, End) of `Units`, counted across the nodes in
+// order.
+static std::vector<native_cpu::numa_node_t>
+sliceUnits(const std::vector<native_cpu::numa_node_t> &Units, size_t Begin,
+           size_t End) {
+  std::vector<native_cpu::numa_node_t> Slice;
+  size_t NodeBegin = 0;
+  for (const auto &Node : Units) {
+    const size_t NodeEnd = NodeBegin + Node.cpus.size();
+    const size_t First = std::max(Begin, NodeBegin);
+    const size_t Last = std::min(End, NodeEnd);
+    if (First < Last) {
+      Slice.push_back({Node.id,
+                       {Node.cpus.begin() + (First - NodeBegin),
+                        Node.cpus.begin() + (Last - NodeBegin)}});
+    }
+    NodeBegin = NodeEnd;
+  }
+  return Slice;
+}
+
+static bool
+samePartition(const std::vector<ur_device_partition_property_t> &A,
+              const std::vector<ur_device_partition_property_t> &B) {
+  return std::equal(A.begin(), A.end(), B.begin(), B.end(),
+                    [](const ur_device_partition_property_t &L,
+                       const ur_device_partition_property_t &R) {
+                      if (L.type != R.type) {
+                        return false;
+                      }
+                      switch (L.type) {
+                      case UR_DEVICE_PARTITION_EQUALLY:
+                        return L.value.equally == R.value.equally;
+                      case UR_DEVICE_PARTITION_BY_COUNTS:
+                        return L.value.count == R.value.count;
+                      default:
+                        return L.value.affinity_domain ==
+                               R.value.affinity_domain;
+                      }
+                    });
+}
+
+ur_device_handle_t_::ur_device_handle_t_(ur_platform_handle_t ArgPlt)
+    : Platform(ArgPlt),
+      Units(native_cpu::worker_placement_t(native_cpu::host_numa_nodes(),
+                                           tp.num_threads())
+                .worker_nodes()),
+      HostInfo(native_cpu::host_info_t::probe()) {}
+
+ur_device_handle_t_::ur_device_handle_t_(
+    ur_device_handle_t Parent, std::vector<native_cpu::numa_node_t> ArgUnits,
+    std::vector<ur_device_partition_property_t> ArgPartition)
+    : tp(native_cpu::worker_placement_t(ArgUnits, countUnits(ArgUnits))),
+      Platform(Parent->Platform), ParentDevice(Parent),
+      Units(std::move(ArgUnits)), PartitionType(std::move(ArgPartition)),
+      HostInfo(Parent->HostInfo) {}
+
+ur_result_t ur_device_handle_t_::partition(
+    const ur_device_partition_properties_t &Properties, uint32_t NumDevices,
+    ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
+  UR_ASSERT(Properties.PropCount > 0, UR_RESULT_ERROR_INVALID_VALUE);
+  std::vector<ur_device_partition_property_t> Key(
+      Properties.pProperties, Properties.pProperties + Properties.PropCount);
+  const ur_device_partition_t Type = Key[0].type;
+  for (const auto &Prop : Key) {
+    UR_ASSERT(Prop.type == Type, UR_RESULT_ERROR_INVALID_VALUE);
+  }
+
+  const size_t NumUnits = numComputeUnits();
+  std::vector<std::vector<native_cpu::numa_node_t>> SubUnits;
+  switch (Type) {
+  case UR_DEVICE_PARTITION_EQUALLY: {
+    UR_ASSERT(Key.size() == 1 && Key[0].value.equally > 0,
+              UR_RESULT_ERROR_INVALID_VALUE);
+    const size_t PerDevice = Key[0].value.equally;
+    UR_ASSERT(PerDevice <= NumUnits, UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+    for (size_t Begin = 0; Begin + PerDevice <= NumUnits; Begin += PerDevice) {
+      SubUnits.push_back(sliceUnits(Units, Begin, Begin + PerDevice));
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_COUNTS: {
+    size_t Begin = 0;
+    for (const auto &Prop : Key) {
+      UR_ASSERT(Prop.value.count > 0 && Begin + Prop.value.count <= NumUnits,
+                UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT);
+      SubUnits.push_back(sliceUnits(Units, Begin, Begin + Prop.value.count));
+      Begin += Prop.value.count;
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN:
+    UR_ASSERT(Key.size() == 1, UR_RESULT_ERROR_INVALID_VALUE);
+    // NUMA nodes are the only affinity domain, so both split the same way.
+    if (Key[0].value.affinity_domain ==
+        UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE) {
+      Key[0].value.affinity_domain = UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA;
+    }
+    UR_ASSERT(Key[0].value.affinity_domain ==
+                  UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA,
+              UR_RESULT_ERROR_INVALID_VALUE);
+    UR_ASSERT(Units.size() > 1, UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+    for (const auto &Node : Units) {
+      SubUnits.push_back({Node});
+    }
+    break;
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  if (pNumDevicesRet) {
+    *pNumDevicesRet = static_cast<uint32_t>(SubUnits.size());
+  }
+  if (!phSubDevices) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  std::lock_guard<std::mutex> Lock(PartitionMutex);
+  auto Partition =
+      std::find_if(Partitions.begin(), Partitions.end(), [&Key](auto &Entry) {
+        return samePartition(Entry.first, Key);
+      });
+  if (Partition == Partitions.end()) {
+    Partition = Partitions.insert(
+        Partitions.end(),
+        {Key, std::vector<ur_device_handle_t>(SubUnits.size(), nullptr)});
+  }
+  auto &SubDevices = Partition->second;
+  const size_t Count = std::min<size_t>(NumDevices, SubDevices.size());
+
+  // Create the missing sub-devices, which start their own worker threads,
+  // before handing out any reference so that a failure leaves no trace
+  std::vector<std::unique_ptr<ur_device_handle_t_>> Created(Count);
+  try {
+    for (size_t I = 0; I < Count; I++) {
+      if (!SubDevices[I]) {
+        Created[I] = std::make_unique<ur_device_handle_t_>(
+            this, std::move(SubUnits[I]), Key);
+      }
+    }
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+
+  for (size_t I = 0; I < Count; I++) {
+    if (SubDevices[I]) {
+      SubDevices[I]->incrementReferenceCount();
+    } else {
+      // Sub-devices hold a reference to their parent, unless it is the root
+      // device whose reference count is left unchanged
+      if (ParentDevice) {
+        incrementReferenceCount();
+      }
+      SubDevices[I] = Created[I].release();
+    }
+    phSubDevices[I] = SubDevices[I];
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+bool ur_device_handle_t_::releaseSubDevice(ur_device_handle_t SubDevice) {
+  {
+    std::lock_guard<std::mutex> Lock(PartitionMutex);
+    if (SubDevice->decrementReferenceCount() != 0) {
+      return false;
+    }
+    for (auto &Partition : Partitions) {
+      std::replace(Partition.second.begin(), Partition.second.end(), SubDevice,
+                   ur_device_handle_t{nullptr});
+    }
+    // Forget partitions once all of their sub-devices are gone
+    Partitions.erase(
+        std::remove_if(Partitions.begin(), Partitions.end(),
+                       [](const auto &Partition) {
+                         return std::all_of(
+                             Partition.second.begin(), Partition.second.end(),
+                             [](ur_device_handle_t Device) { return !Device; });
+                       }),
+        Partitions.end());
+  }
+  delete SubDevice;
+  return true;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
                                                 ur_device_type_t DeviceType,
                                                 uint32_t NumEntries,
@@ -62,7 +260,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_TYPE:
     return ReturnValue(UR_DEVICE_TYPE_CPU);
   case UR_DEVICE_INFO_PARENT_DEVICE:
-    return ReturnValue(nullptr);
+    return ReturnValue(hDevice->ParentDevice);
   case UR_DEVICE_INFO_PLATFORM:
     return ReturnValue(hDevice->Platform);
   case UR_DEVICE_INFO_NAME:
@@ -98,16 +296,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_LINKER_AVAILABLE:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_MAX_COMPUTE_UNITS:
-    return ReturnValue(static_cast<uint32_t>(hDevice->tp.num_threads()));
+    return ReturnValue(static_cast<uint32_t>(hDevice->numComputeUnits()));
   case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES:
-    return ReturnValue(uint32_t{0});
-  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS:
-    // TODO: Ensure this property is tested correctly
-    // Taken from CUDA ur adapter
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
-    }
-    return UR_RESULT_SUCCESS;
+    return ReturnValue(static_cast<uint32_t>(hDevice->numComputeUnits()));
+  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS: {
+    // Splitting by affinity domain needs more than one NUMA node
+    const ur_device_partition_t Partitions[] = {
+        UR_DEVICE_PARTITION_EQUALLY, UR_DEVICE_PARTITION_BY_COUNTS,
+        UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN};
+    return ReturnValue(Partitions, hDevice->Units.size() > 1 ? 3 : 2);
+  }
   case UR_DEVICE_INFO_VENDOR_ID:
     // '0x8086' : 'Intel HD graphics vendor ID'
     return ReturnValue(uint32_t{0x8086});
@@ -139,10 +337,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS:
     return ReturnValue(uint32_t{3});
   case UR_DEVICE_INFO_PARTITION_TYPE:
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
-    }
-    return UR_RESULT_SUCCESS;
+    return ReturnValue(hDevice->PartitionType.data(),
+                       hDevice->PartitionType.size());
   case UR_EXT_DEVICE_INFO_OPENCL_C_VERSION:
     return ReturnValue("");
   case UR_DEVICE_INFO_QUEUE_PROPERTIES:
@@ -150,34 +346,32 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
         ur_queue_flag_t(UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE |
                         UR_QUEUE_FLAG_PROFILING_ENABLE));
   case UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES: {
+    // Work-items of a group run in a loop on one worker, so any dimension
+    // can take the whole group.
     struct {
       size_t Arr[3];
-    } MaxGroupSize = {{256, 256, 256}};
+    } MaxGroupSize = {{2048, 2048, 2048}};
     return ReturnValue(MaxGroupSize);
   }
+  // Vectors as wide as the widest registers of the host
   case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_CHAR:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_SHORT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_INT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_LONG:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_FLOAT:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_DOUBLE:
-  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_HALF:
-  // TODO: How can we query vector width in a platform
-  // independent way?
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_CHAR:
-    return ReturnValue(uint32_t{32});
+    return ReturnValue(uint32_t{hDevice->HostInfo.simdWidth});
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_SHORT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_SHORT:
-    return ReturnValue(uint32_t{16});
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_HALF:
+  case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_HALF:
+    return ReturnValue(uint32_t{hDevice->HostInfo.simdWidth / 2});
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_INT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_INT:
-    return ReturnValue(uint32_t{8});
-  case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_LONG:
-    return ReturnValue(uint32_t{4});
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_FLOAT:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_FLOAT:
-    return ReturnValue(uint32_t{8});
+    return ReturnValue(uint32_t{hDevice->HostInfo.simdWidth / 4});
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_LONG:
+  case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_LONG:
+  case UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_DOUBLE:
   case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_DOUBLE:
-    return ReturnValue(uint32_t{4});
-  case UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_HALF:
-    return ReturnValue(uint32_t{16});
+    return ReturnValue(uint32_t{hDevice->HostInfo.simdWidth / 8});
   // Imported from level_zero
   case UR_DEVICE_INFO_USM_HOST_SUPPORT:
   case UR_DEVICE_INFO_USM_DEVICE_SUPPORT:
@@ -217,17 +411,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHE_TYPE:
     return ReturnValue(UR_DEVICE_MEM_CACHE_TYPE_READ_WRITE_CACHE);
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHELINE_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint32_t{64});
+    return ReturnValue(uint32_t{hDevice->HostInfo.cache_line_size()});
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHE_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(uint64_t{hDevice->HostInfo.last_level_cache_size()});
   case UR_DEVICE_INFO_GLOBAL_MEM_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{32768});
-  case UR_DEVICE_INFO_LOCAL_MEM_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{32768});
+    return ReturnValue(uint64_t{hDevice->HostInfo.memSize});
+  case UR_DEVICE_INFO_GLOBAL_MEM_FREE:
+    return ReturnValue(
+        uint64_t{native_cpu::read_meminfo("/proc/meminfo", "MemAvailable")});
+  case UR_DEVICE_INFO_LOCAL_MEM_SIZE: {
+    // Local memory is plain host memory of the worker running the group, so
+    // it is fastest while it stays in the worker's L2 cache.
+    uint64_t LocalMemSize = hDevice->HostInfo.cache_size(2);
+    if (LocalMemSize == 0) {
+      LocalMemSize = hDevice->HostInfo.cache_size(1);
+    }
+    return ReturnValue(LocalMemSize ? LocalMemSize : uint64_t{32768});
+  }
   case UR_DEVICE_INFO_MAX_CONSTANT_BUFFER_SIZE:
     // TODO : CHECK
     return ReturnValue(uint64_t{0});
@@ -240,8 +440,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ERROR_CORRECTION_SUPPORT:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION:
-    // TODO : CHECK
-    return ReturnValue(size_t{0});
+    return ReturnValue(native_cpu::get_timer_resolution());
   case UR_DEVICE_INFO_BUILT_IN_KERNELS:
     // TODO : CHECK
     return ReturnValue("");
@@ -250,11 +449,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(size_t{1024});
   case UR_DEVICE_INFO_PREFERRED_INTEROP_USER_SYNC:
     return ReturnValue(bool{false});
-  case UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN:
-    return ReturnValue(ur_device_affinity_domain_flags_t{0});
+  case UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN: {
+    ur_device_affinity_domain_flags_t Domains = 0;
+    if (hDevice->Units.size() > 1) {
+      Domains = UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA |
+                UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE;
+    }
+    return ReturnValue(Domains);
+  }
   case UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE:
-    // TODO : CHECK
-    return ReturnValue(uint64_t{0});
+    return ReturnValue(uint64_t{hDevice->HostInfo.memSize});
   case UR_DEVICE_INFO_EXECUTION_CAPABILITIES:
     // TODO : CHECK
     return ReturnValue(ur_device_exec_capability_flags_t{
@@ -262,8 +466,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_PROFILE:
     return ReturnValue("FULL_PROFILE");
   case UR_DEVICE_INFO_REFERENCE_COUNT:
-    // TODO : CHECK
-    return ReturnValue(uint32_t{0});
+    return ReturnValue(uint32_t{hDevice->getReferenceCount()});
   case UR_DEVICE_INFO_BUILD_ON_SUBDEVICE:
     return ReturnValue(bool{0});
   case UR_DEVICE_INFO_ATOMIC_64:
@@ -313,18 +516,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
     CASE_UR_UNSUPPORTED(UR_DEVICE_INFO_MAX_MEMORY_BANDWIDTH);
   case UR_DEVICE_INFO_VIRTUAL_MEMORY_SUPPORT:
+#ifdef __linux__
+    return ReturnValue(true);
+#else
     return ReturnValue(false);
+#endif
 
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_TIMESTAMP_RECORDING_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
     return ReturnValue(false);
 
+  case UR_DEVICE_INFO_HOST_PIPE_READ_WRITE_SUPPORTED:
+    // Nothing connects a host pipe to the kernels of a program yet
+    return ReturnValue(false);
+
   default:
     DIE_NO_IMPLEMENTATION;
   }
@@ -334,6 +545,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
+  // The reference count of a root device is left unchanged
+  if (!hDevice->ParentDevice) {
+    return UR_RESULT_SUCCESS;
+  }
+  hDevice->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
@@ -341,6 +557,19 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urDeviceRelease(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
+  // The reference count of a root device is left unchanged, it belongs to
+  // the platform and is never deleted
+  if (!hDevice->ParentDevice) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Deleting a sub-device drops the reference it holds on its parent, if
+  // that is a sub-device as well
+  ur_device_handle_t Parent = hDevice->ParentDevice;
+  while (Parent->releaseSubDevice(hDevice) && Parent->ParentDevice) {
+    hDevice = Parent;
+    Parent = hDevice->ParentDevice;
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -348,21 +577,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
     ur_device_handle_t hDevice,
     const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
     ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
-  std::ignore = hDevice;
-  std::ignore = NumDevices;
-  std::ignore = pProperties;
-  std::ignore = phSubDevices;
-  std::ignore = pNumDevicesRet;
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pProperties && pProperties->pProperties,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  return hDevice->partition(*pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_device_handle_t hDevice, ur_native_handle_t *phNativeDevice) {
-  std::ignore = hDevice;
-  std::ignore = phNativeDevice;
-
-  DIE_NO_IMPLEMENTATION
+  // The device has no native handle of its own, use the UR handle so the
+  // USM pool manager can tell devices apart.
+  *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
@@ -380,19 +608,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
     uint64_t *pHostTimestamp) {
-  std::ignore = hDevice; // todo
+  std::ignore = hDevice;
+  // The device is the host, so both use the clock the event profiling
+  // timestamps are taken with.
+  const uint64_t Timestamp = native_cpu::get_timestamp();
   if (pHostTimestamp) {
-    using namespace std::chrono;
-    *pHostTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pHostTimestamp = Timestamp;
   }
   if (pDeviceTimestamp) {
-    // todo: calculate elapsed time properly
-    using namespace std::chrono;
-    *pDeviceTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pDeviceTimestamp = Timestamp;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -10,12 +10,66 @@
 
 #pragma once
 
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
 #include "threadpool.hpp"
+#include "topology.hpp"
 #include <ur/ur.hpp>
 
-struct ur_device_handle_t_ {
+struct ur_device_handle_t_ : RefCounted {
   native_cpu::threadpool_t tp;
-  ur_device_handle_t_(ur_platform_handle_t ArgPlt) : Platform(ArgPlt) {}
+
+  // Root device, with one compute unit per worker of `tp`.
+  ur_device_handle_t_(ur_platform_handle_t ArgPlt);
+
+  // Sub-device of `Parent` on `ArgUnits`, with a thread pool pinned to them.
+  ur_device_handle_t_(ur_device_handle_t Parent,
+                      std::vector<native_cpu::numa_node_t> ArgUnits,
+                      std::vector<ur_device_partition_property_t> ArgPartition);
+
+  // Sub-devices that are still referenced when the platform goes away are
+  // deleted with it.
+  ~ur_device_handle_t_() {
+    for (auto &Partition : Partitions) {
+      for (auto SubDevice : Partition.second) {
+        delete SubDevice;
+      }
+    }
+  }
+
+  size_t numComputeUnits() const noexcept { return tp.num_threads(); }
+
+  // Implements urDevicePartition. Sub-devices that are still alive are
+  // handed out again when partitioning the same way, so that pools keyed on
+  // them keep working.
+  ur_result_t partition(const ur_device_partition_properties_t &Properties,
+                        uint32_t NumDevices, ur_device_handle_t *phSubDevices,
+                        uint32_t *pNumDevicesRet);
+
+  // Drops a reference to `SubDevice`, and deletes it if that was the last
+  // one. Returns whether it was deleted.
+  bool releaseSubDevice(ur_device_handle_t SubDevice);
 
   ur_platform_handle_t Platform;
+  ur_device_handle_t ParentDevice = nullptr;
+
+  // The compute units of the device, grouped by NUMA node with one CPU entry
+  // per unit, see native_cpu::worker_placement_t::worker_nodes.
+  std::vector<native_cpu::numa_node_t> Units;
+
+  // Properties the device was partitioned from its parent with.
+  std::vector<ur_device_partition_property_t> PartitionType;
+
+  // Memory, caches and vector units of the host, probed once.
+  const native_cpu::host_info_t HostInfo;
+
+private:
+  std::mutex PartitionMutex;
+  // Sub-devices by partition, null once released.
+  std::vector<std::pair<std::vector<ur_device_partition_property_t>,
+                        std::vector<ur_device_handle_t>>>
+      Partitions;
 };
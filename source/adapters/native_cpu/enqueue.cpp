@@ -6,71 +6,30 @@
 //
 //===----------------------------------------------------------------------===//
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 
 #include "ur_api.h"
 
+#include "bulk_memory.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "enqueue.hpp"
 #include "kernel.hpp"
+#include "kernel_batch.hpp"
 #include "memory.hpp"
+#include "parallel_for.hpp"
+#include "program.hpp"
 #include "queue.hpp"
 #include "threadpool.hpp"
 
-namespace native_cpu {
-struct NDRDescT {
-  using RangeT = std::array<size_t, 3>;
-  uint32_t WorkDim;
-  RangeT GlobalOffset;
-  RangeT GlobalSize;
-  RangeT LocalSize;
-  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
-           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
-      : WorkDim(WorkDim) {
-    for (uint32_t I = 0; I < WorkDim; I++) {
-      GlobalOffset[I] = GlobalWorkOffset[I];
-      GlobalSize[I] = GlobalWorkSize[I];
-      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
-    }
-    for (uint32_t I = WorkDim; I < 3; I++) {
-      GlobalSize[I] = 1;
-      LocalSize[I] = LocalSize[0] ? 1 : 0;
-      GlobalOffset[I] = 0;
-    }
-  }
-
-  void dump(std::ostream &os) const {
-    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
-       << GlobalSize[2] << "\n";
-    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
-       << LocalSize[2] << "\n";
-    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
-       << GlobalOffset[2] << "\n";
-  }
-};
-} // namespace native_cpu
-
-#ifdef NATIVECPU_USE_OCK
-static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
-                                         size_t itemsPerThread) {
-  native_cpu::state resized_state(
-      ndr.GlobalSize[0], ndr.GlobalSize[1], ndr.GlobalSize[2], itemsPerThread,
-      ndr.LocalSize[1], ndr.LocalSize[2], ndr.GlobalOffset[0],
-      ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
-  return resized_state;
-}
-#endif
-
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
@@ -81,196 +40,191 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     DIE_NO_IMPLEMENTATION;
   }
 
-  // Check reqd_work_group_size
-  if (hKernel->hasReqdWGSize() && pLocalWorkSize != nullptr) {
-    const auto &Reqd = hKernel->getReqdWGSize();
-    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
-      if (pLocalWorkSize[Dim] != Reqd[Dim]) {
-        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
-      }
-    }
+  if (auto Err =
+          native_cpu::checkReqdWGSize(hKernel, workDim, pLocalWorkSize)) {
+    return Err;
   }
 
   // TODO: add proper error checking
-  // TODO: add proper event dep management
   native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
                            pLocalWorkSize);
   auto &tp = hQueue->device->tp;
   const size_t numParallelThreads = tp.num_threads();
-  hKernel->updateMemPool(numParallelThreads);
-  std::vector<std::future<void>> futures;
-  std::vector<std::function<void(size_t, ur_kernel_handle_t_)>> groups;
-  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
-  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
-  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
-  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
-                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
-                          ndr.LocalSize[2], ndr.GlobalOffset[0],
-                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
-#ifndef NATIVECPU_USE_OCK
-  hKernel->handleLocalArgs(1, 0);
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->_args.data(), &state);
-            }
-          }
-        }
-      }
-    }
+  // The arguments are captured now, so that the host can set new arguments
+  // while this launch is pending.
+  auto launch = new native_cpu::kernel_launch_t(
+      hKernel, hKernel->captureArgs(), ndr, numParallelThreads);
+
+  if (hQueue->isInOrder() && native_cpu::kernel_batch_t::enabled()) {
+    return hQueue->enqueueBatchedLaunch(launch, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
   }
-#else
-  bool isLocalSizeOne =
-      ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
-  if (isLocalSizeOne && ndr.GlobalSize[0] > numParallelThreads) {
-    // If the local size is one, we make the assumption that we are running a
-    // parallel_for over a sycl::range.
-    // Todo: we could add compiler checks and
-    // kernel properties for this (e.g. check that no barriers are called, no
-    // local memory args).
-
-    // Todo: this assumes that dim 0 is the best dimension over which we want to
-    // parallelize
-
-    // Since we also vectorize the kernel, and vectorization happens within the
-    // work group loop, it's better to have a large-ish local size. We can
-    // divide the global range by the number of threads, set that as the local
-    // size and peel everything else.
-
-    size_t new_num_work_groups_0 = numParallelThreads;
-    size_t itemsPerThread = ndr.GlobalSize[0] / numParallelThreads;
-
-    for (unsigned g2 = 0; g2 < numWG2; g2++) {
-      for (unsigned g1 = 0; g1 < numWG1; g1++) {
-        for (unsigned g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
-          futures.emplace_back(
-              tp.schedule_task([&ndr = std::as_const(ndr), itemsPerThread,
-                                hKernel, g0, g1, g2](size_t) {
-                native_cpu::state resized_state =
-                    getResizedState(ndr, itemsPerThread);
-                resized_state.update(g0, g1, g2);
-                hKernel->_subhandler(hKernel->_args.data(), &resized_state);
-              }));
-        }
-        // Peel the remaining work items. Since the local size is 1, we iterate
-        // over the work groups.
-        for (unsigned g0 = new_num_work_groups_0 * itemsPerThread; g0 < numWG0;
-             g0++) {
-          state.update(g0, g1, g2);
-          hKernel->_subhandler(hKernel->_args.data(), &state);
-        }
-      }
-    }
 
-  } else {
-    // We are running a parallel_for over an nd_range
-
-    if (numWG1 * numWG2 >= numParallelThreads) {
-      // Dimensions 1 and 2 have enough work, split them across the threadpool
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          futures.emplace_back(
-              tp.schedule_task([state, kernel = *hKernel, numWG0, g1, g2,
-                                numParallelThreads](size_t threadId) mutable {
-                for (unsigned g0 = 0; g0 < numWG0; g0++) {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                }
-              }));
-        }
-      }
-    } else {
-      // Split dimension 0 across the threadpool
-      // Here we try to create groups of workgroups in order to reduce
-      // synchronization overhead
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          for (unsigned g0 = 0; g0 < numWG0; g0++) {
-            groups.push_back(
-                [state, g0, g1, g2, numParallelThreads](
-                    size_t threadId, ur_kernel_handle_t_ kernel) mutable {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                });
-          }
-        }
-      }
-      auto numGroups = groups.size();
-      auto groupsPerThread = numGroups / numParallelThreads;
-      auto remainder = numGroups % numParallelThreads;
-      for (unsigned thread = 0; thread < numParallelThreads; thread++) {
-        futures.emplace_back(tp.schedule_task(
-            [&groups, thread, groupsPerThread, hKernel](size_t threadId) {
-              for (unsigned i = 0; i < groupsPerThread; i++) {
-                auto index = thread * groupsPerThread + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
-      }
-
-      // schedule the remaining tasks
-      if (remainder) {
-        futures.emplace_back(
-            tp.schedule_task([&groups, remainder,
-                              scheduled = numParallelThreads * groupsPerThread,
-                              hKernel](size_t threadId) {
-              for (unsigned i = 0; i < remainder; i++) {
-                auto index = scheduled + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
-      }
-    }
+  auto Result = hQueue->enqueueCommand(
+      UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp, launch](ur_event_handle_t hEvent) {
+        native_cpu::parallel_for_chunks(
+            tp, launch->numUnits(),
+            [&tp, launch, hEvent](size_t threadId, size_t begin, size_t end) {
+              hEvent->setRunning();
+              launch->run(launch->threadArgs(tp, threadId), begin, end);
+            },
+            [launch, hEvent]() {
+              hEvent->setRunning();
+              delete launch;
+              hEvent->complete();
+            });
+      });
+  if (Result != UR_RESULT_SUCCESS) {
+    delete launch;
   }
-
-  for (auto &f : futures)
-    f.get();
-#endif // NATIVECPU_USE_OCK
-  // TODO: we should avoid calling clear here by avoiding using push_back
-  // in setKernelArgs.
-  hKernel->_args.clear();
-  hKernel->_localArgInfo.clear();
-  return UR_RESULT_SUCCESS;
+  return Result;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  return hQueue->enqueueMarker(UR_COMMAND_EVENTS_WAIT, numEventsInWaitList,
+                               phEventWaitList, phEvent, false);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  return hQueue->enqueueMarker(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER,
+                               numEventsInWaitList, phEventWaitList, phEvent,
+                               true);
+}
+
+// Enqueues a command that has nothing to do, such as a copy of memory onto
+// itself, so that it still takes its place in the queue.
+static ur_result_t enqueueNoOp(ur_queue_handle_t hQueue,
+                               ur_command_t commandType,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent,
+                               bool blocking = false) {
+  return hQueue->enqueueCommand(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [](ur_event_handle_t hEvent) {
+        hEvent->setRunning();
+        hEvent->complete();
+      },
+      blocking);
+}
+
+// Returns the layout of a rect copy, with the contiguous rows and slices
+// collapsed, and moves the pointers to the first row of the region.
+static native_cpu::bulk::strided_region_t
+rectRegion(int8_t *&Dst, const int8_t *&Src, ur_rect_offset_t dstOrigin,
+           ur_rect_offset_t srcOrigin, ur_rect_region_t region,
+           size_t dstRowPitch, size_t dstSlicePitch, size_t srcRowPitch,
+           size_t srcSlicePitch) {
+  Dst += dstOrigin.z * dstSlicePitch + dstOrigin.y * dstRowPitch + dstOrigin.x;
+  Src += srcOrigin.z * srcSlicePitch + srcOrigin.y * srcRowPitch + srcOrigin.x;
+  native_cpu::bulk::strided_region_t Region{
+      region.width, region.height, region.depth, dstRowPitch,
+      dstSlicePitch, srcRowPitch,  srcSlicePitch};
+  Region.collapse();
+  return Region;
+}
+
+void native_cpu::copyRect(void *pDst, const void *pSrc,
+                          ur_rect_offset_t dstOrigin,
+                          ur_rect_offset_t srcOrigin, ur_rect_region_t region,
+                          size_t dstRowPitch, size_t dstSlicePitch,
+                          size_t srcRowPitch, size_t srcSlicePitch) {
+  auto *Dst = static_cast<int8_t *>(pDst);
+  auto *Src = static_cast<const int8_t *>(pSrc);
+  const auto Region =
+      rectRegion(Dst, Src, dstOrigin, srcOrigin, region, dstRowPitch,
+                 dstSlicePitch, srcRowPitch, srcSlicePitch);
+  const bool NonTemporal =
+      Region.size() >= native_cpu::bulk::nonTemporalThreshold;
+  for (size_t Row = 0; Row < Region.numTotalRows(); Row++) {
+    native_cpu::bulk::copy(Dst + Region.dstOffset(Row),
+                           Src + Region.srcOffset(Row), Region.rowSize,
+                           NonTemporal);
+  }
+}
+
+// Enqueues a rect fill or copy that runs `op(row, begin, end)` over pieces of
+// the rows of the region, in parallel if the region is large.
+template <typename OpT>
+static ur_result_t
+enqueueStridedOp(ur_queue_handle_t hQueue, ur_command_t commandType,
+                 uint32_t numEventsInWaitList,
+                 const ur_event_handle_t *phEventWaitList,
+                 ur_event_handle_t *phEvent,
+                 const native_cpu::bulk::strided_region_t &Region,
+                 size_t granule, OpT &&op, bool blocking = false) {
+  auto &tp = hQueue->device->tp;
+  return hQueue->enqueueCommand(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp, Region, granule,
+       op = std::forward<OpT>(op)](ur_event_handle_t hEvent) {
+        native_cpu::bulk::parallelRows(
+            tp, Region, granule,
+            [op, hEvent](size_t Row, size_t Begin, size_t End) {
+              hEvent->setRunning();
+              op(Row, Begin, End);
+            },
+            [hEvent]() { hEvent->complete(); });
+      },
+      blocking);
+}
+
+static inline ur_result_t
+doCopyRect_impl(ur_queue_handle_t hQueue, void *DstPtr, const void *SrcPtr,
+                ur_rect_offset_t DstOrigin, ur_rect_offset_t SrcOrigin,
+                ur_rect_region_t region, size_t DstRowPitch,
+                size_t DstSlicePitch, size_t SrcRowPitch, size_t SrcSlicePitch,
+                uint32_t numEventsInWaitList,
+                const ur_event_handle_t *phEventWaitList,
+                ur_event_handle_t *phEvent, ur_command_t commandType,
+                bool blocking) {
+  auto *Dst = static_cast<int8_t *>(DstPtr);
+  auto *Src = static_cast<const int8_t *>(SrcPtr);
+  const auto Region =
+      rectRegion(Dst, Src, DstOrigin, SrcOrigin, region, DstRowPitch,
+                 DstSlicePitch, SrcRowPitch, SrcSlicePitch);
+  // Every row would be copied onto itself, e.g. reading a buffer that was
+  // created on the host memory back into it
+  if (Dst == Src && Region.dstRowPitch == Region.srcRowPitch &&
+      Region.dstSlicePitch == Region.srcSlicePitch) {
+    return enqueueNoOp(hQueue, commandType, numEventsInWaitList,
+                       phEventWaitList, phEvent, blocking);
+  }
+  const bool NonTemporal =
+      Region.size() >= native_cpu::bulk::nonTemporalThreshold;
+  return enqueueStridedOp(
+      hQueue, commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      Region, native_cpu::bulk::chunkSize,
+      [Dst, Src, Region, NonTemporal](size_t Row, size_t Begin, size_t End) {
+        native_cpu::bulk::copy(Dst + Region.dstOffset(Row) + Begin,
+                               Src + Region.srcOffset(Row) + Begin,
+                               End - Begin, NonTemporal);
+      },
+      blocking);
 }
 
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t, ur_mem_handle_t Buff, bool,
+    ur_queue_handle_t hQueue, ur_mem_handle_t Buff, bool blocking,
     ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
-  // TODO: events, blocking, check other constraints, performance optimizations
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent, ur_command_t commandType) {
+  // TODO: check other constraints
   //       More sharing with level_zero where possible
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(Buff, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   if (BufferRowPitch == 0)
     BufferRowPitch = region.width;
@@ -280,59 +234,121 @@ static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
     HostRowPitch = region.width;
   if (HostSlicePitch == 0)
     HostSlicePitch = HostRowPitch * region.height;
-  for (size_t w = 0; w < region.width; w++)
-    for (size_t h = 0; h < region.height; h++)
-      for (size_t d = 0; d < region.depth; d++) {
-        size_t buff_orign = (d + BufferOffset.z) * BufferSlicePitch +
-                            (h + BufferOffset.y) * BufferRowPitch + w +
-                            BufferOffset.x;
-        size_t host_origin = (d + HostOffset.z) * HostSlicePitch +
-                             (h + HostOffset.y) * HostRowPitch + w +
-                             HostOffset.x;
-        int8_t &buff_mem = ur_cast<int8_t *>(Buff->_mem)[buff_orign];
-        if constexpr (IsRead)
-          ur_cast<int8_t *>(DstMem)[host_origin] = buff_mem;
-        else
-          buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
-      }
-  return UR_RESULT_SUCCESS;
-}
-
-static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
-                                      const void *SrcPtr, size_t Size,
-                                      uint32_t numEventsInWaitList,
-                                      const ur_event_handle_t *EventWaitList,
-                                      ur_event_handle_t *Event) {
-  // todo: non-blocking, events, UR integration
-  std::ignore = EventWaitList;
-  std::ignore = Event;
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  if (SrcPtr != DstPtr && Size)
-    memmove(DstPtr, SrcPtr, Size);
-  return UR_RESULT_SUCCESS;
+  if constexpr (IsRead)
+    return doCopyRect_impl(hQueue, DstMem, Buff->_mem, HostOffset,
+                           BufferOffset, region, HostRowPitch, HostSlicePitch,
+                           BufferRowPitch, BufferSlicePitch,
+                           numEventsInWaitList, phEventWaitList, phEvent,
+                           commandType, blocking);
+  else
+    return doCopyRect_impl(hQueue, Buff->_mem, DstMem, BufferOffset,
+                           HostOffset, region, BufferRowPitch,
+                           BufferSlicePitch, HostRowPitch, HostSlicePitch,
+                           numEventsInWaitList, phEventWaitList, phEvent,
+                           commandType, blocking);
+}
+
+// Enqueues a fill or copy that runs `op(begin, end)` over pieces of the
+// `size` bytes it operates on, in parallel if the operation is large.
+template <typename OpT>
+static ur_result_t
+enqueueBulkOp(ur_queue_handle_t hQueue, ur_command_t commandType,
+              uint32_t numEventsInWaitList,
+              const ur_event_handle_t *phEventWaitList,
+              ur_event_handle_t *phEvent, size_t size, size_t granule, OpT &&op,
+              bool blocking = false) {
+  auto &tp = hQueue->device->tp;
+  return hQueue->enqueueCommand(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp, size, granule,
+       op = std::forward<OpT>(op)](ur_event_handle_t hEvent) {
+        native_cpu::bulk::parallelRanges(
+            tp, size, granule,
+            [op, hEvent](size_t begin, size_t end) {
+              hEvent->setRunning();
+              op(begin, end);
+            },
+            [hEvent]() { hEvent->complete(); });
+      },
+      blocking);
+}
+
+static inline ur_result_t
+doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr, const void *SrcPtr,
+            size_t Size, uint32_t numEventsInWaitList,
+            const ur_event_handle_t *EventWaitList, ur_event_handle_t *Event,
+            ur_command_t commandType, bool blocking) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // E.g. reading a buffer that was created on the host memory back into it
+  if (DstPtr == SrcPtr) {
+    return enqueueNoOp(hQueue, commandType, numEventsInWaitList,
+                       EventWaitList, Event, blocking);
+  }
+
+  auto *Dst = static_cast<int8_t *>(DstPtr);
+  auto *Src = static_cast<const int8_t *>(SrcPtr);
+  // Overlapping ranges are moved as a single piece.
+  const bool Overlap = Dst < Src + Size && Src < Dst + Size;
+  const size_t Granule =
+      Overlap ? std::max<size_t>(Size, 1) : native_cpu::bulk::chunkSize;
+  const bool NonTemporal = Size >= native_cpu::bulk::nonTemporalThreshold;
+  return enqueueBulkOp(
+      hQueue, commandType, numEventsInWaitList, EventWaitList, Event, Size,
+      Granule,
+      [Dst, Src, Overlap, NonTemporal](size_t Begin, size_t End) {
+        if (Overlap) {
+          memmove(Dst, Src, End - Begin);
+          return;
+        }
+        native_cpu::bulk::copy(Dst + Begin, Src + Begin, End - Begin,
+                               NonTemporal);
+      },
+      blocking);
+}
+
+static inline ur_result_t
+doFill_impl(ur_queue_handle_t hQueue, void *Ptr, const void *pPattern,
+            size_t PatternSize, size_t Size, uint32_t numEventsInWaitList,
+            const ur_event_handle_t *EventWaitList, ur_event_handle_t *Event,
+            ur_command_t commandType) {
+  // The pattern is copied, as the caller may reuse it once this returns.
+  std::vector<uint8_t> Pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   PatternSize);
+  const bool NonTemporal = Size >= native_cpu::bulk::nonTemporalThreshold;
+  return enqueueBulkOp(
+      hQueue, commandType, numEventsInWaitList, EventWaitList, Event, Size,
+      native_cpu::bulk::fillGranule(PatternSize),
+      [Ptr = static_cast<uint8_t *>(Ptr), Pattern = std::move(Pattern),
+       NonTemporal](size_t Begin, size_t End) {
+        native_cpu::bulk::fill(Ptr + Begin, Pattern.data(), Pattern.size(),
+                               End - Begin, NonTemporal);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
   return doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_READ,
+                     blockingRead);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   void *ToPtr = hBuffer->_mem + offset;
   return doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_WRITE,
+                     blockingWrite);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
@@ -345,7 +361,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
       hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_READ_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
@@ -358,7 +375,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   return enqueueMemBufferReadWriteRect_impl<false /*write*/>(
       hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_WRITE_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
@@ -366,10 +384,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  UR_ASSERT(hBufferSrc, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBufferDst, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
   return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_COPY,
+                     false);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
@@ -380,10 +402,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
-      hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
+      hQueue, hBufferSrc, false, srcOrigin,
       /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
       dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
-      phEvent);
+      phEvent, UR_COMMAND_MEM_BUFFER_COPY_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
@@ -391,22 +413,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
     size_t patternSize, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
   // TODO: error checking
-  // TODO: handle async
   void *startingPtr = hBuffer->_mem + offset;
-  unsigned steps = size / patternSize;
-  for (unsigned i = 0; i < steps; i++) {
-    memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-           patternSize);
-  }
-
-  return UR_RESULT_SUCCESS;
+  return doFill_impl(hQueue, startingPtr, pPattern, patternSize, size,
+                     numEventsInWaitList, phEventWaitList, phEvent,
+                     UR_COMMAND_MEM_BUFFER_FILL);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
@@ -473,102 +488,66 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     ur_map_flags_t mapFlags, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = hQueue;
-  std::ignore = blockingMap;
   std::ignore = mapFlags;
   std::ignore = size;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(ppRetMap, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // The buffer lives in host memory, so the mapping is known straight away,
+  // the command only has to respect the ordering of the queue.
   *ppRetMap = hBuffer->_mem + offset;
 
-  return UR_RESULT_SUCCESS;
+  return enqueueNoOp(hQueue, UR_COMMAND_MEM_BUFFER_MAP, numEventsInWaitList,
+                     phEventWaitList, phEvent, blockingMap);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = hMem;
   std::ignore = pMappedPtr;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
-  return UR_RESULT_SUCCESS;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // Writes through the mapping went straight to the buffer
+  return enqueueNoOp(hQueue, UR_COMMAND_MEM_UNMAP, numEventsInWaitList,
+                     phEventWaitList, phEvent);
+}
+
+void native_cpu::fillUSM(void *ptr, size_t patternSize, const void *pPattern,
+                         size_t size) {
+  native_cpu::bulk::fill(ptr, pPattern, patternSize, size,
+                         size >= native_cpu::bulk::nonTemporalThreshold);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(size % patternSize == 0 || patternSize > size,
             UR_RESULT_ERROR_INVALID_SIZE);
 
-  switch (patternSize) {
-  case 1:
-    memset(ptr, *static_cast<const uint8_t *>(pPattern), size * patternSize);
-    break;
-  case 2: {
-    const auto pattern = *static_cast<const uint16_t *>(pPattern);
-    auto *start = reinterpret_cast<uint16_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint16_t *>(reinterpret_cast<uint16_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 4: {
-    const auto pattern = *static_cast<const uint32_t *>(pPattern);
-    auto *start = reinterpret_cast<uint32_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint32_t *>(reinterpret_cast<uint32_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 8: {
-    const auto pattern = *static_cast<const uint64_t *>(pPattern);
-    auto *start = reinterpret_cast<uint64_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint64_t *>(reinterpret_cast<uint64_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  default:
-    for (unsigned int step{0}; step < size; ++step) {
-      auto *dest = reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(ptr) +
-                                            step * patternSize);
-      memcpy(dest, pPattern, patternSize);
-    }
-  }
-  return UR_RESULT_SUCCESS;
+  return doFill_impl(hQueue, ptr, pPattern, patternSize, size,
+                     numEventsInWaitList, phEventWaitList, phEvent,
+                     UR_COMMAND_USM_FILL);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  memcpy(pDst, pSrc, size);
-
-  return UR_RESULT_SUCCESS;
+  return doCopy_impl(hQueue, pDst, pSrc, size, numEventsInWaitList,
+                     phEventWaitList, phEvent, UR_COMMAND_USM_MEMCPY, blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
@@ -598,23 +577,56 @@ urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
   DIE_NO_IMPLEMENTATION;
 }
 
+// Returns whether the `size` bytes at `ptr` run past the end of the USM
+// allocation `ptr` points into. Pointers to other host memory are not checked.
+static bool isOutOfUSMBounds(ur_queue_handle_t hQueue, const void *ptr,
+                             size_t size) {
+  const auto Alloc = hQueue->context->_usmAllocs.find(ptr);
+  if (!Alloc) {
+    return false;
+  }
+  const size_t Offset = static_cast<const int8_t *>(ptr) -
+                        static_cast<const int8_t *>(Alloc->base);
+  return size > Alloc->size - Offset;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
     ur_queue_handle_t hQueue, void *pMem, size_t pitch, size_t patternSize,
     const void *pPattern, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = pMem;
-  std::ignore = pitch;
-  std::ignore = patternSize;
-  std::ignore = pPattern;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(width > 0 && height > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(pitch >= width, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(patternSize > 0 && (patternSize & (patternSize - 1)) == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(patternSize <= width * height, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(width * height % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+  // The last row only needs to be `width` long
+  UR_ASSERT(!isOutOfUSMBounds(hQueue, pMem, pitch * (height - 1) + width),
+            UR_RESULT_ERROR_INVALID_SIZE);
 
-  DIE_NO_IMPLEMENTATION;
+  // The pattern runs on from one row to the next, as if the rows were
+  // contiguous.
+  native_cpu::bulk::strided_region_t Region{
+      width, height, 1, pitch, pitch * height, pitch, pitch * height};
+  Region.collapse();
+  std::vector<uint8_t> Pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   patternSize);
+  const bool NonTemporal =
+      Region.size() >= native_cpu::bulk::nonTemporalThreshold;
+  return enqueueStridedOp(
+      hQueue, UR_COMMAND_USM_FILL_2D, numEventsInWaitList, phEventWaitList,
+      phEvent, Region, native_cpu::bulk::chunkSize,
+      [Ptr = static_cast<uint8_t *>(pMem), Region, Pattern = std::move(Pattern),
+       NonTemporal](size_t Row, size_t Begin, size_t End) {
+        native_cpu::bulk::fill(Ptr + Region.dstOffset(Row) + Begin,
+                               Pattern.data(), Pattern.size(), End - Begin,
+                               NonTemporal, Row * Region.rowSize + Begin);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
@@ -622,19 +634,57 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     const void *pSrc, size_t srcPitch, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = pDst;
-  std::ignore = dstPitch;
-  std::ignore = pSrc;
-  std::ignore = srcPitch;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(height > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(dstPitch > 0 && dstPitch >= width, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(srcPitch > 0 && srcPitch >= width, UR_RESULT_ERROR_INVALID_SIZE);
+  // The last rows only need to be `width` long
+  UR_ASSERT(!isOutOfUSMBounds(hQueue, pDst, dstPitch * (height - 1) + width),
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(!isOutOfUSMBounds(hQueue, pSrc, srcPitch * (height - 1) + width),
+            UR_RESULT_ERROR_INVALID_SIZE);
 
-  DIE_NO_IMPLEMENTATION;
+  return doCopyRect_impl(hQueue, pDst, pSrc, {}, {}, {width, height, 1},
+                         dstPitch, dstPitch * height, srcPitch,
+                         srcPitch * height, numEventsInWaitList,
+                         phEventWaitList, phEvent, UR_COMMAND_USM_MEMCPY_2D,
+                         blocking);
+}
+
+template <bool IsRead>
+static ur_result_t enqueueDeviceGlobalVariableReadWrite_impl(
+    ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
+    bool blocking, size_t count, size_t offset, void *ptr,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hProgram, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(name, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  auto *global = hProgram->_globals.find(name);
+  UR_ASSERT(global, UR_RESULT_ERROR_INVALID_VALUE);
+  // Copies into globals of unknown size can't be checked, so aren't done
+  if (global->size == 0) {
+    logger::error("The size of device global {} isn't known", name);
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+  UR_ASSERT(offset <= global->size && count <= global->size - offset,
+            UR_RESULT_ERROR_INVALID_VALUE);
+
+  // The variable is in the host process, so it is copied to or from directly
+  auto *variable = global->ptr + offset;
+  if constexpr (IsRead) {
+    return doCopy_impl(hQueue, ptr, variable, count, numEventsInWaitList,
+                       phEventWaitList, phEvent,
+                       UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ, blocking);
+  } else {
+    return doCopy_impl(hQueue, variable, ptr, count, numEventsInWaitList,
+                       phEventWaitList, phEvent,
+                       UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE, blocking);
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
@@ -642,18 +692,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     bool blockingWrite, size_t count, size_t offset, const void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = hProgram;
-  std::ignore = name;
-  std::ignore = blockingWrite;
-  std::ignore = count;
-  std::ignore = offset;
-  std::ignore = pSrc;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  return enqueueDeviceGlobalVariableReadWrite_impl<false>(
+      hQueue, hProgram, name, blockingWrite, count, offset,
+      const_cast<void *>(pSrc), numEventsInWaitList, phEventWaitList, phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
@@ -661,18 +702,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     bool blockingRead, size_t count, size_t offset, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = hProgram;
-  std::ignore = name;
-  std::ignore = blockingRead;
-  std::ignore = count;
-  std::ignore = offset;
-  std::ignore = pDst;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  return enqueueDeviceGlobalVariableReadWrite_impl<true>(
+      hQueue, hProgram, name, blockingRead, count, offset, pDst,
+      numEventsInWaitList, phEventWaitList, phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
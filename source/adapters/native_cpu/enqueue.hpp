@@ -0,0 +1,216 @@
+//===----------- enqueue.hpp - Native CPU Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "ur_api.h"
+
+#include "common.hpp"
+#include "kernel.hpp"
+#include "nativecpu_state.hpp"
+#include "threadpool.hpp"
+
+namespace native_cpu {
+struct NDRDescT {
+  using RangeT = std::array<size_t, 3>;
+  uint32_t WorkDim;
+  RangeT GlobalOffset;
+  RangeT GlobalSize;
+  RangeT LocalSize;
+  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
+           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
+      : WorkDim(WorkDim) {
+    for (uint32_t I = 0; I < WorkDim; I++) {
+      GlobalOffset[I] = GlobalWorkOffset[I];
+      GlobalSize[I] = GlobalWorkSize[I];
+      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
+    }
+    for (uint32_t I = WorkDim; I < 3; I++) {
+      GlobalSize[I] = 1;
+      LocalSize[I] = LocalSize[0] ? 1 : 0;
+      GlobalOffset[I] = 0;
+    }
+  }
+
+  void dump(std::ostream &os) const {
+    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
+       << GlobalSize[2] << "\n";
+    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
+       << LocalSize[2] << "\n";
+    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
+       << GlobalOffset[2] << "\n";
+  }
+};
+
+#ifdef NATIVECPU_USE_OCK
+inline state getResizedState(const NDRDescT &ndr, size_t itemsPerThread) {
+  state resized_state(ndr.GlobalSize[0], ndr.GlobalSize[1], ndr.GlobalSize[2],
+                      itemsPerThread, ndr.LocalSize[1], ndr.LocalSize[2],
+                      ndr.GlobalOffset[0], ndr.GlobalOffset[1],
+                      ndr.GlobalOffset[2]);
+  return resized_state;
+}
+#endif
+
+// A kernel launch, partitioned for the thread pool. The work is split into
+// units that are handed out to the thread pool in chunks: a unit is a
+// work-group, or for kernels over a sycl::range a run of work-items along
+// dimension 0. The launch holds a reference to the kernel and a copy of its
+// arguments, so it can be executed any number of times.
+struct kernel_launch_t {
+  kernel_launch_t(ur_kernel_handle_t hKernel, kernel_args_t &&args,
+                  const NDRDescT &ndr, size_t numParallelThreads)
+      : kernel(hKernel), args(std::move(args)), ndr(ndr),
+        numParallelThreads(numParallelThreads) {
+    kernel->incrementReferenceCount();
+    for (int I = 0; I < 3; I++) {
+      numWG[I] = ndr.GlobalSize[I] / ndr.LocalSize[I];
+    }
+    numUnits0 = numWG[0];
+#ifdef NATIVECPU_USE_OCK
+    bool isLocalSizeOne =
+        ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
+    if (isLocalSizeOne && ndr.GlobalSize[0] > numParallelThreads) {
+      // If the local size is one, we make the assumption that we are running
+      // a parallel_for over a sycl::range.
+      // Todo: we could add compiler checks and
+      // kernel properties for this (e.g. check that no barriers are called, no
+      // local memory args).
+
+      // Todo: this assumes that dim 0 is the best dimension over which we
+      // want to parallelize
+
+      // Since we also vectorize the kernel, and vectorization happens within
+      // the work group loop, it's better to have a large-ish local size. We
+      // split dimension 0 into a few runs of items per thread, which are
+      // executed as work-groups of that size, and peel the remainder.
+      constexpr size_t runsPerThread = 4;
+      itemsPerRun = std::max<size_t>(
+          ndr.GlobalSize[0] / (numParallelThreads * runsPerThread), 1);
+      numFullRuns = ndr.GlobalSize[0] / itemsPerRun;
+      numUnits0 = numFullRuns + (ndr.GlobalSize[0] % itemsPerRun ? 1 : 0);
+    }
+#endif
+  }
+
+  kernel_launch_t(const kernel_launch_t &) = delete;
+  kernel_launch_t &operator=(const kernel_launch_t &) = delete;
+
+  ~kernel_launch_t() { kernel->release(); }
+
+  size_t numUnits() const { return numUnits0 * numWG[1] * numWG[2]; }
+
+  // Argument descriptors for work-groups executed by the worker `threadId`.
+  // Local arguments are placed in the worker's arena, launches without local
+  // arguments share the captured descriptors.
+  const NativeCPUArgDesc *threadArgs(threadpool_t &tp, size_t threadId) const {
+    if (!args.hasLocalArgs()) {
+      return args._args.data();
+    }
+    return args.bindLocalArgs(
+        tp.local_arena(threadId).get(args.threadStorageSize()));
+  }
+
+  // Executes the units [begin, end) on the calling thread.
+  void run(const NativeCPUArgDesc *args, size_t begin, size_t end) const {
+    native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
+                            ndr.GlobalSize[2], ndr.LocalSize[0],
+                            ndr.LocalSize[1], ndr.LocalSize[2],
+                            ndr.GlobalOffset[0], ndr.GlobalOffset[1],
+                            ndr.GlobalOffset[2]);
+#ifndef NATIVECPU_USE_OCK
+    for (size_t unit = begin; unit < end; unit++) {
+      const size_t g0 = unit % numWG[0];
+      const size_t g1 = unit / numWG[0] % numWG[1];
+      const size_t g2 = unit / (numWG[0] * numWG[1]);
+      for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
+        for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
+          for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
+            state.update(g0, g1, g2, local0, local1, local2);
+            kernel->_subhandler(args, &state);
+          }
+        }
+      }
+    }
+#else
+    if (itemsPerRun) {
+      native_cpu::state resized_state = getResizedState(ndr, itemsPerRun);
+      for (size_t unit = begin; unit < end; unit++) {
+        const size_t run = unit % numUnits0;
+        const size_t g1 = unit / numUnits0 % numWG[1];
+        const size_t g2 = unit / (numUnits0 * numWG[1]);
+        if (run < numFullRuns) {
+          resized_state.update(run, g1, g2);
+          kernel->_subhandler(args, &resized_state);
+          continue;
+        }
+        // Peel the remaining work items. Since the local size is 1, we
+        // iterate over the work groups.
+        for (size_t g0 = numFullRuns * itemsPerRun; g0 < numWG[0]; g0++) {
+          state.update(g0, g1, g2);
+          kernel->_subhandler(args, &state);
+        }
+      }
+      return;
+    }
+    for (size_t unit = begin; unit < end; unit++) {
+      state.update(unit % numWG[0], unit / numWG[0] % numWG[1],
+                   unit / (numWG[0] * numWG[1]));
+      kernel->_subhandler(args, &state);
+    }
+#endif
+  }
+
+  ur_kernel_handle_t const kernel;
+  kernel_args_t args;
+  const NDRDescT ndr;
+  const size_t numParallelThreads;
+  size_t numWG[3];
+  // Units along dimension 0, work-groups unless running by runs of items
+  size_t numUnits0;
+  // Only used for kernels over a sycl::range
+  size_t itemsPerRun = 0;
+  size_t numFullRuns = 0;
+};
+
+// Checks the local size of a launch against the kernel's
+// reqd_work_group_size, if it has one.
+inline ur_result_t checkReqdWGSize(ur_kernel_handle_t hKernel, uint32_t workDim,
+                                   const size_t *pLocalWorkSize) {
+  if (hKernel->hasReqdWGSize() && pLocalWorkSize != nullptr) {
+    const auto &Reqd = hKernel->getReqdWGSize();
+    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
+      if (pLocalWorkSize[Dim] != Reqd[Dim]) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
+      }
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// Host implementations of the memory commands, shared by the queue and
+// command-buffer entry points.
+
+// Fills `size` bytes at `ptr` with the `patternSize` bytes long pattern.
+void fillUSM(void *ptr, size_t patternSize, const void *pPattern, size_t size);
+
+// Copies a 3D region between two host allocations. Origins are given in
+// bytes, rows and slices of the respective allocation.
+void copyRect(void *pDst, const void *pSrc, ur_rect_offset_t dstOrigin,
+              ur_rect_offset_t srcOrigin, ur_rect_region_t region,
+              size_t dstRowPitch, size_t dstSlicePitch, size_t srcRowPitch,
+              size_t srcSlicePitch);
+
+} // namespace native_cpu
@@ -11,50 +11,217 @@
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+
+ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
+                                       ur_command_t commandType)
+    : queue(queue), commandType(commandType), status(UR_EVENT_STATUS_QUEUED),
+      profiled((queue->flags & UR_QUEUE_FLAG_PROFILING_ENABLE) ||
+               commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP) {
+  queue->incrementReferenceCount();
+  if (profiled) {
+    timestamps[UR_EVENT_STATUS_QUEUED] = native_cpu::get_timestamp();
+  }
+}
+
+ur_event_handle_t_::~ur_event_handle_t_() { decrementOrDelete(queue); }
+
+ur_context_handle_t ur_event_handle_t_::getContext() const noexcept {
+  return queue->context;
+}
+
+void ur_event_handle_t_::wait() {
+  if (isComplete()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  completed.wait(lock, [this]() { return isComplete(); });
+}
+
+void ur_event_handle_t_::setSubmitted() { setStatus(UR_EVENT_STATUS_SUBMITTED); }
+
+void ur_event_handle_t_::setRunning() {
+  if (getExecutionStatus() > UR_EVENT_STATUS_RUNNING) {
+    setStatus(UR_EVENT_STATUS_RUNNING);
+  }
+}
+
+void ur_event_handle_t_::setStatus(ur_event_status_t newStatus) {
+  std::vector<callback_t> ready;
+  std::vector<std::function<void()>> toRun;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Statuses only ever move towards UR_EVENT_STATUS_COMPLETE
+    const auto oldStatus = getExecutionStatus();
+    if (newStatus >= oldStatus) {
+      return;
+    }
+    if (profiled) {
+      // Statuses that were skipped are reached at the same time
+      const uint64_t now = native_cpu::get_timestamp();
+      for (int s = newStatus; s < oldStatus; s++) {
+        timestamps[s] = now;
+      }
+    }
+    status.store(newStatus, std::memory_order_release);
+    auto reached = std::stable_partition(
+        callbacks.begin(), callbacks.end(), [newStatus](const callback_t &c) {
+          return static_cast<int>(c.execStatus) < static_cast<int>(newStatus);
+        });
+    ready.assign(reached, callbacks.end());
+    callbacks.erase(reached, callbacks.end());
+    if (newStatus == UR_EVENT_STATUS_COMPLETE) {
+      toRun.swap(dependents);
+    }
+  }
+  if (newStatus == UR_EVENT_STATUS_COMPLETE) {
+    completed.notify_all();
+  }
+  for (auto &c : ready) {
+    c.pfnNotify(this, c.execStatus, c.pUserData);
+  }
+  for (auto &fn : toRun) {
+    fn();
+  }
+}
+
+void ur_event_handle_t_::complete() {
+  setStatus(UR_EVENT_STATUS_COMPLETE);
+  queue->eventCompleted(this);
+  // Drop the reference held by the command, this may delete the event
+  decrementOrDelete(this);
+}
+
+bool ur_event_handle_t_::whenComplete(std::function<void()> &&fn) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (isComplete()) {
+    return false;
+  }
+  dependents.emplace_back(std::move(fn));
+  return true;
+}
+
+void ur_event_handle_t_::addCallback(ur_execution_info_t execStatus,
+                                     ur_event_callback_t pfnNotify,
+                                     void *pUserData) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (static_cast<int>(execStatus) < static_cast<int>(getExecutionStatus())) {
+      callbacks.push_back({execStatus, pfnNotify, pUserData});
+      return;
+    }
+  }
+  pfnNotify(this, execStatus, pUserData);
+}
+
+ur_result_t ur_event_handle_t_::getProfilingInfo(ur_profiling_info_t propName,
+                                                 size_t propSize,
+                                                 void *pPropValue,
+                                                 size_t *pPropSizeRet) {
+  ur_event_status_t reached;
+  switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+    reached = UR_EVENT_STATUS_QUEUED;
+    break;
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    reached = UR_EVENT_STATUS_SUBMITTED;
+    break;
+  case UR_PROFILING_INFO_COMMAND_START:
+    reached = UR_EVENT_STATUS_RUNNING;
+    break;
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    reached = UR_EVENT_STATUS_COMPLETE;
+    break;
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+  if (commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP) {
+    // A timestamp is submitted when it is queued, and recorded as a single
+    // point in time once the commands before it have completed.
+    if (reached == UR_EVENT_STATUS_SUBMITTED) {
+      reached = UR_EVENT_STATUS_QUEUED;
+    } else if (reached == UR_EVENT_STATUS_COMPLETE) {
+      reached = UR_EVENT_STATUS_RUNNING;
+    }
+  }
+
+  uint64_t timestamp;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (getExecutionStatus() > reached) {
+      return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+    }
+    timestamp = timestamps[reached];
+  }
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  return ReturnValue(timestamp);
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EVENT_INFO_COMMAND_QUEUE:
+    return ReturnValue(hEvent->getQueue());
+  case UR_EVENT_INFO_CONTEXT:
+    return ReturnValue(hEvent->getContext());
+  case UR_EVENT_INFO_COMMAND_TYPE:
+    return ReturnValue(hEvent->getCommandType());
+  case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+    return ReturnValue(hEvent->getExecutionStatus());
+  case UR_EVENT_INFO_REFERENCE_COUNT:
+    return ReturnValue(hEvent->getReferenceCount());
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(!pPropValue || propSize, UR_RESULT_ERROR_INVALID_VALUE);
 
-  DIE_NO_IMPLEMENTATION;
+  if (!hEvent->isProfiled()) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+  return hEvent->getProfilingInfo(propName, propSize, pPropValue,
+                                  pPropSizeRet);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
-  std::ignore = numEvents;
-  std::ignore = phEventWaitList;
-  // TODO: currently we do everything synchronously so this is a no-op
+  UR_ASSERT(numEvents == 0 || phEventWaitList,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  for (uint32_t i = 0; i < numEvents; i++) {
+    UR_ASSERT(phEventWaitList[i], UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    phEventWaitList[i]->wait();
+  }
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  hEvent->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  decrementOrDelete(hEvent);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
@@ -80,22 +247,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
                    ur_event_callback_t pfnNotify, void *pUserData) {
-  std::ignore = hEvent;
-  std::ignore = execStatus;
-  std::ignore = pfnNotify;
-  std::ignore = pUserData;
+  UR_ASSERT(hEvent, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pfnNotify, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(execStatus <= UR_EXECUTION_INFO_QUEUED,
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
 
-  DIE_NO_IMPLEMENTATION;
+  hEvent->addCallback(execStatus, pfnNotify, pUserData);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phEvent, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  // Recorded once the previous commands have completed, like a marker
+  return hQueue->enqueueMarker(UR_COMMAND_TIMESTAMP_RECORDING_EXP,
+                               numEventsInWaitList, phEventWaitList, phEvent,
+                               false, blocking);
 }
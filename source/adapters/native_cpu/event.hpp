@@ -0,0 +1,100 @@
+//===----------- event.hpp - Native CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "common.hpp"
+#include "ur_api.h"
+
+struct ur_event_handle_t_ : RefCounted {
+  // The event retains its queue, so that the queue outlives every command
+  // that was enqueued to it.
+  ur_event_handle_t_(ur_queue_handle_t queue, ur_command_t commandType);
+
+  ~ur_event_handle_t_();
+
+  // Blocks the calling thread until the command has completed.
+  void wait();
+
+  // Marks the command as handed to the device, once its dependencies have
+  // been resolved.
+  void setSubmitted();
+
+  // Marks the command as running, called by the first task of the command to
+  // start executing. Only the first call has an effect.
+  void setRunning();
+
+  // Marks the command as complete, wakes up waiters and runs the registered
+  // callbacks and dependent commands. This drops the reference held by the
+  // command, so the event must not be used by the caller afterwards.
+  void complete();
+
+  // Registers a function to run once the command has completed. Returns false
+  // if the command has already completed, in which case `fn` is not stored
+  // and the caller is responsible for running it.
+  bool whenComplete(std::function<void()> &&fn);
+
+  // Registers a urEventSetCallback callback for `execStatus`. Callbacks for
+  // a status the event has already reached are called straight away.
+  void addCallback(ur_execution_info_t execStatus, ur_event_callback_t pfnNotify,
+                   void *pUserData);
+
+  bool isComplete() const noexcept {
+    return getExecutionStatus() == UR_EVENT_STATUS_COMPLETE;
+  }
+
+  ur_event_status_t getExecutionStatus() const noexcept {
+    return status.load(std::memory_order_acquire);
+  }
+
+  ur_queue_handle_t getQueue() const noexcept { return queue; }
+
+  ur_context_handle_t getContext() const noexcept;
+
+  ur_command_t getCommandType() const noexcept { return commandType; }
+
+  // Whether the event records when its command reaches each status, which
+  // is the case for commands of a queue with UR_QUEUE_FLAG_PROFILING_ENABLE
+  // and for timestamp recordings.
+  bool isProfiled() const noexcept { return profiled; }
+
+  // Implements urEventGetProfilingInfo for a profiled event.
+  ur_result_t getProfilingInfo(ur_profiling_info_t propName, size_t propSize,
+                               void *pPropValue, size_t *pPropSizeRet);
+
+private:
+  struct callback_t {
+    ur_execution_info_t execStatus;
+    ur_event_callback_t pfnNotify;
+    void *pUserData;
+  };
+
+  // Moves the event to `newStatus` and calls the callbacks registered for it.
+  void setStatus(ur_event_status_t newStatus);
+
+  ur_queue_handle_t const queue;
+  const ur_command_t commandType;
+  std::atomic<ur_event_status_t> status;
+  const bool profiled;
+
+  // When the command reached each status, indexed by ur_event_status_t and
+  // only written if the event is profiled.
+  uint64_t timestamps[UR_EVENT_STATUS_QUEUED + 1] = {};
+
+  std::mutex mutex;
+  std::condition_variable completed;
+  std::vector<callback_t> callbacks;
+  std::vector<std::function<void()>> dependents;
+};
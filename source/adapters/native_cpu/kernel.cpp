@@ -21,23 +21,20 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
                ur_kernel_handle_t *phKernel) {
   UR_ASSERT(hProgram, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pKernelName, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(phKernel, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  auto kernelEntry = hProgram->_kernels.find(pKernelName);
-  if (kernelEntry == hProgram->_kernels.end())
+  const auto *entry = hProgram->_kernels.find(pKernelName);
+  if (!entry)
     return UR_RESULT_ERROR_INVALID_KERNEL;
 
-  auto f = reinterpret_cast<nativecpu_ptr_t>(
-      const_cast<unsigned char *>(kernelEntry->second));
-  ur_kernel_handle_t_ *kernel;
-
-  // Set reqd_work_group_size for kernel if needed
-  const auto &ReqdMap = hProgram->KernelReqdWorkGroupSizeMD;
-  auto ReqdIt = ReqdMap.find(pKernelName);
-  if (ReqdIt != ReqdMap.end()) {
-    kernel = new ur_kernel_handle_t_(hProgram, pKernelName, *f, ReqdIt->second);
+  ur_kernel_handle_t_ *kernel = hProgram->popFreeKernel();
+  if (kernel) {
+    kernel->reset(*entry);
   } else {
-    kernel = new ur_kernel_handle_t_(hProgram, pKernelName, *f);
+    kernel = new ur_kernel_handle_t_(hProgram, *entry);
   }
+  // Released by ur_kernel_handle_t_::release when the kernel is recycled
+  hProgram->incrementReferenceCount();
 
   *phKernel = kernel;
 
@@ -49,17 +46,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     const ur_kernel_arg_value_properties_t *pProperties,
     const void *pArgValue) {
   // Todo: error checking
-  // Todo: I think that the opencl spec (and therefore the pi spec mandates that
-  // arg is copied (this is why it is defined as const void*, I guess we should
-  // do it
-  // TODO: can args arrive out of order?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
+  UR_ASSERT(pArgValue, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  hKernel->_args.emplace_back(const_cast<void *>(pArgValue));
+  // The value is copied, as the kernel may run after the caller's storage
+  // has gone away.
+  hKernel->setArgValue(argIndex, argSize, pArgValue);
 
   return UR_RESULT_SUCCESS;
 }
@@ -68,10 +63,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
     const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
-  // emplace a placeholder kernel arg, gets replaced with a pointer to the
-  // memory pool before enqueueing the kernel.
-  hKernel->_args.emplace_back(nullptr);
-  hKernel->_localArgInfo.emplace_back(argIndex, argSize);
+
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hKernel->setArgLocal(argIndex, argSize);
   return UR_RESULT_SUCCESS;
 }
 
@@ -125,10 +120,8 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   }
   case UR_KERNEL_GROUP_INFO_COMPILE_WORK_GROUP_SIZE: {
     size_t GroupSize[3] = {0, 0, 0};
-    const auto &ReqdWGSizeMDMap = hKernel->hProgram->KernelReqdWorkGroupSizeMD;
-    const auto ReqdWGSizeMD = ReqdWGSizeMDMap.find(hKernel->_name);
-    if (ReqdWGSizeMD != ReqdWGSizeMDMap.end()) {
-      const auto ReqdWGSize = ReqdWGSizeMD->second;
+    if (hKernel->hasReqdWGSize()) {
+      const auto &ReqdWGSize = hKernel->getReqdWGSize();
       GroupSize[0] = std::get<0>(ReqdWGSize);
       GroupSize[1] = std::get<1>(ReqdWGSize);
       GroupSize[2] = std::get<2>(ReqdWGSize);
@@ -190,6 +183,14 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   DIE_NO_IMPLEMENTATION;
 }
 
+void ur_kernel_handle_t_::release() {
+  if (decrementReferenceCount() != 0)
+    return;
+  ur_program_handle_t Program = hProgram;
+  Program->pushFreeKernel(this);
+  decrementOrDelete(Program);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
   hKernel->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
@@ -197,7 +198,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelRelease(ur_kernel_handle_t hKernel) {
-  decrementOrDelete(hKernel);
+  hKernel->release();
 
   return UR_RESULT_SUCCESS;
 }
@@ -206,14 +207,12 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_pointer_properties_t *pProperties,
                       const void *pArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pArgValue, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  hKernel->_args.push_back(const_cast<void *>(pArgValue));
+  hKernel->setArgPointer(argIndex, const_cast<void *>(pArgValue));
 
   return UR_RESULT_SUCCESS;
 }
@@ -247,8 +246,6 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *pProperties,
                      ur_mem_handle_t hArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
@@ -256,11 +253,11 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   // Taken from ur/adapters/cuda/kernel.cpp
   // zero-sized buffers are expected to be null.
   if (hArgValue == nullptr) {
-    hKernel->_args.emplace_back(nullptr);
+    hKernel->setArgPointer(argIndex, nullptr);
     return UR_RESULT_SUCCESS;
   }
 
-  hKernel->_args.emplace_back(hArgValue->_mem);
+  hKernel->setArgPointer(argIndex, hArgValue->_mem);
   return UR_RESULT_SUCCESS;
 }
 
@@ -11,9 +11,14 @@
 #include "common.hpp"
 #include "nativecpu_state.hpp"
 #include "program.hpp"
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
 #include <ur_api.h>
 #include <utility>
+#include <vector>
 
 namespace native_cpu {
 
@@ -37,72 +42,204 @@ struct local_arg_info_t {
       : argIndex(argIndex), argSize(argSize) {}
 };
 
-struct ur_kernel_handle_t_ : RefCounted {
+namespace native_cpu {
+
+// Copy of a kernel's arguments taken when the kernel is enqueued. Argument
+// values are copied, so the host can set new arguments while the launch is
+// still running.
+struct kernel_args_t {
+  kernel_args_t() = default;
+  kernel_args_t(kernel_args_t &&) = default;
+  kernel_args_t &operator=(kernel_args_t &&) = default;
+  // The argument descriptors point into `values`
+  kernel_args_t(const kernel_args_t &) = delete;
+  kernel_args_t &operator=(const kernel_args_t &) = delete;
+
+  std::vector<NativeCPUArgDesc> _args;
+  std::vector<local_arg_info_t> _localArgInfo;
+  std::unique_ptr<char[]> _values;
 
-  ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
-                      nativecpu_task_t subhandler)
-      : hProgram(hProgram), _name{name}, _subhandler{std::move(subhandler)},
-        HasReqdWGSize(false) {}
-
-  ur_kernel_handle_t_(const ur_kernel_handle_t_ &other)
-      : hProgram(other.hProgram), _name(other._name),
-        _subhandler(other._subhandler), _args(other._args),
-        _localArgInfo(other._localArgInfo), _localMemPool(other._localMemPool),
-        _localMemPoolSize(other._localMemPoolSize),
-        HasReqdWGSize(other.HasReqdWGSize), ReqdWGSize(other.ReqdWGSize) {
-    incrementReferenceCount();
+  static constexpr size_t localAlign = 64;
+
+  bool hasLocalArgs() const { return !_localArgInfo.empty(); }
+
+  // Size of the per-thread storage needed by bindLocalArgs: a copy of the
+  // argument descriptors followed by each local argument, all cache-line
+  // aligned.
+  size_t threadStorageSize() const {
+    size_t size = alignUp(_args.size() * sizeof(NativeCPUArgDesc));
+    for (auto &entry : _localArgInfo) {
+      size += alignUp(entry.argSize);
+    }
+    return size;
   }
 
-  ~ur_kernel_handle_t_() {
-    if (decrementReferenceCount() == 0) {
-      free(_localMemPool);
+  // To be called before executing work groups on a thread. Lays out a copy of
+  // the argument descriptors in `storage`, which must hold
+  // threadStorageSize() bytes, with the local arguments pointing into
+  // `storage` as well.
+  const NativeCPUArgDesc *bindLocalArgs(void *storage) const {
+    auto *base = static_cast<char *>(storage);
+    auto *args = reinterpret_cast<NativeCPUArgDesc *>(base);
+    std::uninitialized_copy(_args.begin(), _args.end(), args);
+    size_t offset = alignUp(_args.size() * sizeof(NativeCPUArgDesc));
+    for (auto &entry : _localArgInfo) {
+      args[entry.argIndex].MPtr = base + offset;
+      offset += alignUp(entry.argSize);
     }
+    return args;
   }
-  ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
-                      nativecpu_task_t subhandler,
-                      const native_cpu::ReqdWGSize_t &ReqdWGSize)
-      : hProgram(hProgram), _name{name}, _subhandler{std::move(subhandler)},
-        HasReqdWGSize(true), ReqdWGSize(ReqdWGSize) {}
-
-  ur_program_handle_t hProgram;
-  std::string _name;
-  nativecpu_task_t _subhandler;
-  std::vector<native_cpu::NativeCPUArgDesc> _args;
-  std::vector<local_arg_info_t> _localArgInfo;
 
-  bool hasReqdWGSize() const { return HasReqdWGSize; }
+private:
+  static size_t alignUp(size_t size) {
+    return (size + localAlign - 1) / localAlign * localAlign;
+  }
+};
 
-  const native_cpu::ReqdWGSize_t &getReqdWGSize() const { return ReqdWGSize; }
+// The arguments set on a kernel. Kernels own one, and so do command-buffer
+// kernel commands, which can have their arguments updated independently of
+// the kernel they were created from.
+class kernel_arg_list_t {
+public:
+  void setArgValue(uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    resizeArgs(argIndex);
+    _argValues[argIndex].assign(static_cast<const char *>(pArgValue),
+                                static_cast<const char *>(pArgValue) + argSize);
+    // The descriptor is pointed at the value by capture()
+    _args[argIndex].MPtr = nullptr;
+    removeLocalArg(argIndex);
+  }
 
-  void updateMemPool(size_t numParallelThreads) {
-    // compute requested size.
-    size_t reqSize = 0;
-    for (auto &entry : _localArgInfo) {
-      reqSize += entry.argSize * numParallelThreads;
+  void setArgPointer(uint32_t argIndex, void *pArgValue) {
+    resizeArgs(argIndex);
+    _argValues[argIndex].clear();
+    _args[argIndex].MPtr = pArgValue;
+    removeLocalArg(argIndex);
+  }
+
+  void setArgLocal(uint32_t argIndex, size_t argSize) {
+    // Placeholder, gets replaced with a pointer to the local memory pool
+    // before executing a work group.
+    setArgPointer(argIndex, nullptr);
+    _localArgInfo.emplace_back(argIndex, argSize);
+  }
+
+  // Removes all the arguments, keeping the storage for the next ones.
+  void clear() {
+    _args.clear();
+    _localArgInfo.clear();
+    _argValues.clear();
+  }
+
+  // Takes a copy of the current arguments for a launch.
+  kernel_args_t capture() const {
+    constexpr size_t align = alignof(std::max_align_t);
+    size_t valuesSize = 0;
+    for (auto &value : _argValues) {
+      valuesSize += (value.size() + align - 1) / align * align;
     }
-    if (reqSize == 0 || reqSize == _localMemPoolSize) {
-      return;
+    kernel_args_t res;
+    res._args = _args;
+    res._localArgInfo = _localArgInfo;
+    if (valuesSize) {
+      res._values.reset(new char[valuesSize]);
+      size_t offset = 0;
+      for (size_t i = 0; i < _argValues.size(); i++) {
+        auto &value = _argValues[i];
+        if (value.empty()) {
+          continue;
+        }
+        std::memcpy(res._values.get() + offset, value.data(), value.size());
+        res._args[i].MPtr = res._values.get() + offset;
+        offset += (value.size() + align - 1) / align * align;
+      }
     }
-    // realloc handles nullptr case
-    _localMemPool = (char *)realloc(_localMemPool, reqSize);
-    _localMemPoolSize = reqSize;
+    return res;
   }
 
-  // To be called before executing a work group
-  void handleLocalArgs(size_t numParallelThread, size_t threadId) {
-    // For each local argument we have size*numthreads
-    size_t offset = 0;
-    for (auto &entry : _localArgInfo) {
-      _args[entry.argIndex].MPtr =
-          _localMemPool + offset + (entry.argSize * threadId);
-      // update offset in the memory pool
-      offset += entry.argSize * numParallelThread;
+private:
+  void resizeArgs(uint32_t argIndex) {
+    if (argIndex >= _args.size()) {
+      _args.resize(argIndex + 1, nullptr);
+      _argValues.resize(argIndex + 1);
     }
   }
 
+  void removeLocalArg(uint32_t argIndex) {
+    _localArgInfo.erase(std::remove_if(_localArgInfo.begin(),
+                                       _localArgInfo.end(),
+                                       [argIndex](const local_arg_info_t &a) {
+                                         return a.argIndex == argIndex;
+                                       }),
+                        _localArgInfo.end());
+  }
+
+  std::vector<NativeCPUArgDesc> _args;
+  std::vector<local_arg_info_t> _localArgInfo;
+  // Storage for arguments set by value, indexed by argument. Empty for
+  // arguments that are set by pointer or are local.
+  std::vector<std::vector<char>> _argValues;
+};
+
+} // namespace native_cpu
+
+struct ur_kernel_handle_t_ : RefCounted {
+
+  ur_kernel_handle_t_(ur_program_handle_t hProgram,
+                      const native_cpu::kernel_entry_t &entry)
+      : hProgram(hProgram) {
+    reset(entry);
+  }
+
+  // Sets up a kernel taken from the free-list of its program as a new kernel.
+  void reset(const native_cpu::kernel_entry_t &entry) {
+    _refCount = 1;
+    _name = entry.name.data();
+    _subhandler = reinterpret_cast<nativecpu_ptr_t>(
+        const_cast<unsigned char *>(entry.ptr));
+    HasReqdWGSize = entry.hasReqdWGSize;
+    ReqdWGSize = entry.reqdWGSize;
+    _argList.clear();
+  }
+
+  // Drops a reference. Once the last one is dropped the kernel goes back to
+  // the free-list of its program rather than being deleted, and its
+  // reference to the program is dropped.
+  void release();
+
+  ur_program_handle_t const hProgram;
+  const char *_name;
+  nativecpu_task_t _subhandler;
+  // Link in the free-list of the program while the kernel isn't in use
+  ur_kernel_handle_t_ *_nextFree = nullptr;
+
+  bool hasReqdWGSize() const { return HasReqdWGSize; }
+
+  const native_cpu::ReqdWGSize_t &getReqdWGSize() const { return ReqdWGSize; }
+
+  void setArgValue(uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    _argList.setArgValue(argIndex, argSize, pArgValue);
+  }
+
+  void setArgPointer(uint32_t argIndex, void *pArgValue) {
+    _argList.setArgPointer(argIndex, pArgValue);
+  }
+
+  void setArgLocal(uint32_t argIndex, size_t argSize) {
+    _argList.setArgLocal(argIndex, argSize);
+  }
+
+  const native_cpu::kernel_arg_list_t &getArgList() const { return _argList; }
+
+  // Takes a copy of the current arguments for a launch.
+  native_cpu::kernel_args_t captureArgs() const { return _argList.capture(); }
+
 private:
-  char *_localMemPool = nullptr;
-  size_t _localMemPoolSize = 0;
+  // Only the program deletes its kernels, see release.
+  friend struct ur_program_handle_t_;
+  ~ur_kernel_handle_t_() = default;
+
+  native_cpu::kernel_arg_list_t _argList;
   bool HasReqdWGSize;
   native_cpu::ReqdWGSize_t ReqdWGSize;
 };
@@ -0,0 +1,147 @@
+//===----------- kernel_batch.cpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "kernel_batch.hpp"
+#include "event.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace native_cpu {
+
+// How long workers wait for the others to finish a launch before leaving the
+// batch. Long enough to cover the tail of a small kernel, short enough not to
+// hold on to a worker that other commands could use.
+static constexpr std::chrono::microseconds barrierSpinTime{50};
+
+kernel_batch_t::kernel_batch_t(threadpool_t &tp, kernel_launch_t *launch)
+    : tp(tp) {
+  stages[0].reset(new stage_t{launch, nullptr});
+}
+
+kernel_batch_t::~kernel_batch_t() {
+  for (size_t i = 0; i < numStages; i++) {
+    delete stages[i]->launch;
+  }
+}
+
+bool kernel_batch_t::enabled() {
+  static const bool Enabled = []() {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_KERNEL_BATCHING");
+    return !envVar || std::strcmp(envVar, "0") != 0;
+  }();
+  return Enabled;
+}
+
+bool kernel_batch_t::append(kernel_launch_t *launch, ur_event_handle_t event) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (closed || numStages == maxLaunches) {
+    return false;
+  }
+  stages[numStages++].reset(new stage_t{launch, event});
+  return true;
+}
+
+void kernel_batch_t::start(ur_event_handle_t event) {
+  stages[0]->event = event;
+  startStage(0);
+  // Drop the reference held by the command of the first launch
+  decrementOrDelete(this);
+}
+
+void kernel_batch_t::startStage(size_t index) {
+  auto &stage = *stages[index];
+  stage.event->setRunning();
+  const size_t numUnits = stage.launch->numUnits();
+  if (numUnits == 0) {
+    finishStage(index);
+    return;
+  }
+  const size_t wanted = std::min(numUnits, tp.num_threads());
+  stage.range.emplace(numUnits, wanted, tp.placement());
+  current.store(index, std::memory_order_release);
+  for (size_t n = numWorkers.load(std::memory_order_acquire); n < wanted;
+       n++) {
+    addWorker();
+  }
+}
+
+void kernel_batch_t::finishStage(size_t index) {
+  auto &stage = *stages[index];
+  delete stage.launch;
+  stage.launch = nullptr;
+  bool hasNext;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    hasNext = index + 1 < numStages;
+    closed = !hasNext;
+  }
+  // Completing the launch before starting the next keeps the events in order
+  stage.event->complete();
+  if (!hasNext) {
+    current.store(finished, std::memory_order_release);
+    return;
+  }
+  startStage(index + 1);
+}
+
+void kernel_batch_t::addWorker() {
+  numWorkers.fetch_add(1, std::memory_order_relaxed);
+  incrementReferenceCount();
+  tp.schedule([this](size_t threadId) { work(threadId); });
+}
+
+void kernel_batch_t::work(size_t threadId) {
+  const size_t node = tp.placement().node_of(threadId);
+  size_t index = current.load(std::memory_order_acquire);
+  while (index != finished) {
+    auto &stage = *stages[index];
+    // The launch is only used after claiming a unit, as the worker finishing
+    // the last unit deletes it
+    bool finishedStage = false;
+    size_t begin, end;
+    while (stage.range->claim(node, begin, end)) {
+      auto launch = stage.launch;
+      const size_t numUnits = launch->numUnits();
+      launch->run(launch->threadArgs(tp, threadId), begin, end);
+      const size_t done = end - begin;
+      if (stage.unitsDone.fetch_add(done, std::memory_order_acq_rel) + done ==
+          numUnits) {
+        finishStage(index);
+        finishedStage = true;
+        break;
+      }
+    }
+    if (!finishedStage && !waitForNextStage(index)) {
+      break;
+    }
+    index = current.load(std::memory_order_acquire);
+  }
+  numWorkers.fetch_sub(1, std::memory_order_release);
+  decrementOrDelete(this);
+}
+
+bool kernel_batch_t::waitForNextStage(size_t index) const {
+  const auto deadline = std::chrono::steady_clock::now() + barrierSpinTime;
+  for (unsigned spin = 1;; spin++) {
+    if (current.load(std::memory_order_acquire) != index) {
+      return true;
+    }
+    if (spin % 64 == 0 && std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+}
+
+} // namespace native_cpu
@@ -0,0 +1,103 @@
+//===----------- kernel_batch.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "common.hpp"
+#include "enqueue.hpp"
+#include "parallel_for.hpp"
+#include "threadpool.hpp"
+
+namespace native_cpu {
+
+// Kernel launches that directly follow each other on an in-order queue, run
+// by a single dispatch to the thread pool. Once the work of a launch is all
+// done the workers carry on with the next launch, rather than returning to
+// the pool and being woken up again, so streams of small kernels don't pay
+// for scheduling and waking the workers on every launch.
+//
+// Between two launches the workers wait for each other by spinning for a
+// short while. Workers that give up leave the batch, and the worker that
+// completes a launch schedules new ones if the next launch is short of
+// workers, so a batch never blocks the thread pool.
+class kernel_batch_t : public RefCounted {
+public:
+  // Launches in a batch, further launches start a new batch
+  static constexpr size_t maxLaunches = 64;
+
+  // Takes ownership of `launch`, the first launch of the batch.
+  kernel_batch_t(threadpool_t &tp, kernel_launch_t *launch);
+
+  // Deletes the launches that never ran.
+  ~kernel_batch_t();
+
+  kernel_batch_t(const kernel_batch_t &) = delete;
+  kernel_batch_t &operator=(const kernel_batch_t &) = delete;
+
+  // Batching can be turned off with SYCL_NATIVE_CPU_KERNEL_BATCHING=0.
+  static bool enabled();
+
+  // Adds a launch that runs once the previous one has completed, and then
+  // completes `event`. Fails, without taking ownership of `launch`, if the
+  // batch is full or has already run all of its launches.
+  bool append(kernel_launch_t *launch, ur_event_handle_t event);
+
+  // Starts running the batch once the dependencies of its first launch have
+  // completed, the first launch completes `event`.
+  void start(ur_event_handle_t event);
+
+private:
+  struct stage_t {
+    kernel_launch_t *launch;
+    ur_event_handle_t event;
+    // Set up when the launch starts
+    std::optional<node_ranges_t> range;
+    std::atomic<size_t> unitsDone{0};
+  };
+
+  // Index of the running launch once the batch has run them all
+  static constexpr size_t finished = maxLaunches;
+
+  // Sets up `stage` to run and makes the workers move on to it.
+  void startStage(size_t index);
+
+  // Completes the launch at `index` and starts the next one, if any. Called
+  // by the worker that finished the last unit of the launch.
+  void finishStage(size_t index);
+
+  // Schedules a worker, which holds a reference to the batch.
+  void addWorker();
+
+  // Body of the workers.
+  void work(size_t threadId);
+
+  // Waits for the launch at `index` to be finished by the other workers.
+  // Returns false if it took too long.
+  bool waitForNextStage(size_t index) const;
+
+  threadpool_t &tp;
+  std::mutex mutex;
+  // Only grows, and only accessed under `mutex` before a stage has started
+  std::unique_ptr<stage_t> stages[maxLaunches];
+  size_t numStages = 1;
+  // Set once the batch has run all of its launches, under `mutex`
+  bool closed = false;
+  // Index of the running launch
+  std::atomic<size_t> current{0};
+  // Workers currently in the batch
+  std::atomic<size_t> numWorkers{0};
+};
+
+} // namespace native_cpu
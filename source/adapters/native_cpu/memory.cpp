@@ -9,9 +9,39 @@
 //===----------------------------------------------------------------------===//
 
 #include "memory.hpp"
+#include "bulk_memory.hpp"
 #include "common.hpp"
+#include "usm.hpp"
 #include "ur_api.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+void *native_cpu::allocateBufferMemory(size_t size) {
+#ifndef _WIN32
+  if (size >= bufferMapThreshold) {
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+  }
+#endif
+  // Rounded up so that the next allocation starts on another cache line
+  return allocateHostMemory(
+      (size + bufferAlignment - 1) / bufferAlignment * bufferAlignment,
+      bufferAlignment);
+}
+
+void native_cpu::freeBufferMemory(void *ptr, size_t size) {
+#ifndef _WIN32
+  if (size >= bufferMapThreshold) {
+    munmap(ptr, size);
+    return;
+  }
+#endif
+  freeHostMemory(ptr);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
     ur_context_handle_t hContext, ur_mem_flags_t flags,
     const ur_image_format_t *pImageFormat, const ur_image_desc_t *pImageDesc,
@@ -31,7 +61,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
     const ur_buffer_properties_t *pProperties, ur_mem_handle_t *phBuffer) {
 
   // TODO: add proper error checking and double check flag semantics
-  // TODO: support UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER flag
 
   UR_ASSERT(phBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
@@ -46,16 +75,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
   UR_ASSERT(size != 0, UR_RESULT_ERROR_INVALID_BUFFER_SIZE);
 
   const bool useHostPtr = flags & UR_MEM_FLAG_USE_HOST_POINTER;
-  const bool copyHostPtr = flags & UR_MEM_FLAG_USE_HOST_POINTER;
+  const bool copyHostPtr = flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER;
 
   ur_mem_handle_t_ *retMem;
 
   if (useHostPtr) {
-    retMem = new _ur_buffer(hContext, pProperties->pHost);
-  } else if (copyHostPtr) {
+    // The host memory is the device memory, so the buffer aliases it
     retMem = new _ur_buffer(hContext, pProperties->pHost, size);
   } else {
     retMem = new _ur_buffer(hContext, size);
+    if (!retMem->_mem) {
+      delete retMem;
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    native_cpu::bulk::firstTouch(hContext->_device->tp, retMem->_mem, size);
+    if (copyHostPtr) {
+      native_cpu::bulk::copy(retMem->_mem, pProperties->pHost, size,
+                             size >= native_cpu::bulk::nonTemporalThreshold);
+    }
   }
 
   *phBuffer = retMem;
@@ -11,33 +11,43 @@
 #pragma once
 
 #include <atomic>
-#include <cstdlib>
-#include <cstring>
+#include <cstddef>
 
 #include "common.hpp"
 #include "context.hpp"
 
+namespace native_cpu {
+// Buffers at least this large get a mapping of their own, which is page
+// aligned and only backed by memory once touched.
+constexpr size_t bufferMapThreshold = size_t{1} << 20;
+
+// Alignment of smaller buffers, so that buffers never share a cache line.
+constexpr size_t bufferAlignment = 64;
+
+// Allocates the memory owned by a buffer of `size` bytes. Returns nullptr on
+// failure.
+void *allocateBufferMemory(size_t size);
+void freeBufferMemory(void *ptr, size_t size);
+} // namespace native_cpu
+
 struct ur_mem_handle_t_ : _ur_object {
+  // Owns `Size` bytes, which is null if they could not be allocated.
   ur_mem_handle_t_(size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true},
-        IsImage{_IsImage} {}
+      : _mem{static_cast<char *>(native_cpu::allocateBufferMemory(Size))},
+        _ownsMem{true}, _size{Size}, IsImage{_IsImage} {}
 
+  // Aliases the `Size` bytes at `HostPtr`, without copying them.
   ur_mem_handle_t_(void *HostPtr, size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true}, IsImage{
-                                                                     _IsImage} {
-    memcpy(_mem, HostPtr, Size);
-  }
-
-  ur_mem_handle_t_(void *HostPtr, bool _IsImage)
-      : _mem{static_cast<char *>(HostPtr)}, _ownsMem{false}, IsImage{_IsImage} {
-  }
+      : _mem{static_cast<char *>(HostPtr)}, _ownsMem{false}, _size{Size},
+        IsImage{_IsImage} {}
 
-  ~ur_mem_handle_t_() {
-    if (_ownsMem) {
-      free(_mem);
+  virtual ~ur_mem_handle_t_() {
+    if (_ownsMem && _mem) {
+      native_cpu::freeBufferMemory(_mem, _size);
     }
   }
 
+  void incrementRefCount() noexcept { _refCount++; }
   void decrementRefCount() noexcept { _refCount--; }
 
   // Method to get type of the derived object (image or buffer)
@@ -45,6 +55,7 @@ struct ur_mem_handle_t_ : _ur_object {
 
   char *_mem;
   bool _ownsMem;
+  size_t _size;
   std::atomic_uint32_t _refCount = {1};
 
 private:
@@ -53,15 +64,12 @@ private:
 
 struct _ur_buffer final : ur_mem_handle_t_ {
   // Buffer constructor
-  _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr)
-      : ur_mem_handle_t_(HostPtr, false) {}
   _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr, size_t Size)
       : ur_mem_handle_t_(HostPtr, Size, false) {}
   _ur_buffer(ur_context_handle_t /* Context*/, size_t Size)
       : ur_mem_handle_t_(Size, false) {}
   _ur_buffer(_ur_buffer *b, size_t Offset, size_t Size)
-      : ur_mem_handle_t_(b->_mem + Offset, false), SubBuffer(b) {
-    std::ignore = Size;
+      : ur_mem_handle_t_(b->_mem + Offset, Size, false), SubBuffer(b) {
     SubBuffer.Origin = Offset;
   }
 
@@ -0,0 +1,174 @@
+//===----------- parallel_for.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "topology.hpp"
+
+namespace native_cpu {
+
+// Counts down the tasks of a parallel operation, the call that brings the
+// count to zero is told so and is responsible for signalling completion.
+class completion_latch_t {
+public:
+  explicit completion_latch_t(size_t count) noexcept : m_count(count) {}
+
+  // Returns true for the call that releases the latch.
+  bool count_down() noexcept {
+    return m_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+private:
+  std::atomic<size_t> m_count;
+};
+
+// Hands out [0, size) in guided chunks. Each claim takes a fraction of the
+// remaining range, so the first chunks are large and cheap to schedule, and
+// chunks shrink towards `minChunk` at the end to balance the tail across
+// workers.
+class guided_range_t {
+public:
+  guided_range_t(size_t size, size_t numWorkers, size_t minChunk = 1) noexcept
+      : m_next(0), m_size(size), m_divisor(2 * std::max<size_t>(numWorkers, 1)),
+        m_minChunk(std::max<size_t>(minChunk, 1)) {}
+
+  bool claim(size_t &begin, size_t &end) noexcept {
+    size_t cur = m_next.load(std::memory_order_relaxed);
+    while (cur < m_size) {
+      const size_t chunk = std::max(m_minChunk, (m_size - cur) / m_divisor);
+      const size_t next = std::min(m_size, cur + chunk);
+      if (m_next.compare_exchange_weak(cur, next, std::memory_order_relaxed)) {
+        begin = cur;
+        end = next;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::atomic<size_t> m_next;
+  const size_t m_size;
+  const size_t m_divisor;
+  const size_t m_minChunk;
+};
+
+// Splits [0, size) into one part per NUMA node of the thread pool, in
+// proportion to the workers of the node, and hands out guided chunks of the
+// parts. Workers claim from the part of their own node first, so that
+// launches over the same range process the same indices on the same node,
+// where first-touch placed their data, and then help the other nodes. With a
+// single node this is a plain guided range.
+class node_ranges_t {
+public:
+  // Nodes beyond this share parts
+  static constexpr size_t maxParts = 8;
+
+  node_ranges_t(size_t size, size_t numWorkers,
+                const worker_placement_t &placement) noexcept
+      : m_numParts(std::min(placement.num_nodes(), maxParts)) {
+    if (m_numParts <= 1) {
+      m_numParts = 1;
+      m_parts[0].offset = 0;
+      m_parts[0].range.emplace(size, numWorkers);
+      return;
+    }
+    size_t partWorkers[maxParts] = {};
+    size_t totalWorkers = 0;
+    for (size_t node = 0; node < placement.num_nodes(); node++) {
+      partWorkers[node % maxParts] += placement.num_node_workers(node);
+      totalWorkers += placement.num_node_workers(node);
+    }
+    size_t cumulative = 0;
+    for (size_t i = 0; i < m_numParts; i++) {
+      const size_t begin = size * cumulative / totalWorkers;
+      cumulative += partWorkers[i];
+      const size_t end = size * cumulative / totalWorkers;
+      m_parts[i].offset = begin;
+      m_parts[i].range.emplace(end - begin, partWorkers[i]);
+    }
+  }
+
+  bool claim(size_t node, size_t &begin, size_t &end) noexcept {
+    for (size_t i = 0; i < m_numParts; i++) {
+      auto &part = m_parts[(node + i) % m_numParts];
+      if (part.range->claim(begin, end)) {
+        begin += part.offset;
+        end += part.offset;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  struct alignas(64) part_t {
+    std::optional<guided_range_t> range;
+    size_t offset;
+  };
+
+  size_t m_numParts;
+  part_t m_parts[maxParts];
+};
+
+// Runs `fn(threadId, begin, end)` over guided chunks of [0, size) on the
+// thread pool, using at most one task per worker. Chunks are preferably
+// handed to the workers of the NUMA node owning them, see node_ranges_t. Once
+// every chunk has been processed `done()` is called exactly once, from the
+// thread that finished last. Does not block, and performs a single allocation
+// for the state shared by the tasks.
+template <typename ThreadPoolT, typename ChunkFnT, typename DoneFnT>
+void parallel_for_chunks(ThreadPoolT &tp, size_t size, ChunkFnT &&fn,
+                         DoneFnT &&done) {
+  if (size == 0) {
+    done();
+    return;
+  }
+
+  struct shared_state_t {
+    shared_state_t(size_t size, size_t numTasks,
+                   const worker_placement_t &placement, ChunkFnT &&fn,
+                   DoneFnT &&done)
+        : range(size, numTasks, placement), latch(numTasks),
+          fn(std::forward<ChunkFnT>(fn)), done(std::forward<DoneFnT>(done)) {}
+
+    node_ranges_t range;
+    completion_latch_t latch;
+    std::decay_t<ChunkFnT> fn;
+    std::decay_t<DoneFnT> done;
+  };
+
+  const size_t numTasks = std::min(size, tp.num_threads());
+  const worker_placement_t &placement = tp.placement();
+  auto shared =
+      new shared_state_t(size, numTasks, placement, std::forward<ChunkFnT>(fn),
+                         std::forward<DoneFnT>(done));
+  for (size_t i = 0; i < numTasks; i++) {
+    tp.schedule([shared, &placement](size_t threadId) {
+      const size_t node = placement.node_of(threadId);
+      size_t begin, end;
+      while (shared->range.claim(node, begin, end)) {
+        shared->fn(threadId, begin, end);
+      }
+      if (shared->latch.count_down()) {
+        shared->done();
+        delete shared;
+      }
+    });
+  }
+}
+
+} // namespace native_cpu
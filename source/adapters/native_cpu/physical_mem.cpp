@@ -12,6 +12,55 @@
 #include "common.hpp"
 #include "context.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+
+ur_physical_mem_handle_t_::~ur_physical_mem_handle_t_() { close(Fd); }
+
+UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
+    const ur_physical_mem_properties_t *pProperties,
+    ur_physical_mem_handle_t *phPhysicalMem) {
+  std::ignore = pProperties;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(size && size % native_cpu::virtualMemGranularity() == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  // The pages of the file are only allocated once touched through a mapping
+  const int Fd = memfd_create("ur_physical_mem", MFD_CLOEXEC);
+  if (Fd < 0) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  if (ftruncate(Fd, static_cast<off_t>(size)) != 0) {
+    close(Fd);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *phPhysicalMem = new ur_physical_mem_handle_t_(Fd, size);
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urPhysicalMemRetain(ur_physical_mem_handle_t hPhysicalMem) {
+  UR_ASSERT(hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hPhysicalMem->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
+  UR_ASSERT(hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  decrementOrDelete(hPhysicalMem);
+  return UR_RESULT_SUCCESS;
+}
+#else
+// Physical memory is a memfd_create file, which only Linux provides.
+ur_physical_mem_handle_t_::~ur_physical_mem_handle_t_() {}
+
 UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_context_handle_t, ur_device_handle_t, size_t,
     const ur_physical_mem_properties_t *, ur_physical_mem_handle_t *) {
@@ -27,3 +76,4 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urPhysicalMemRelease(ur_physical_mem_handle_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+#endif
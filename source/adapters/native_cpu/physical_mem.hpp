@@ -9,8 +9,20 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <cstddef>
+
+#include "common.hpp"
+
 /// UR queue mapping on physical memory allocations used in virtual memory
-/// management.
-/// TODO: Implement.
+/// management. The memory is an anonymous memory file, so that it can be
+/// mapped at any number of virtual addresses.
 ///
-struct ur_physical_mem_handle_t_ {};
+struct ur_physical_mem_handle_t_ : RefCounted {
+  ur_physical_mem_handle_t_(int Fd, size_t Size) : Fd(Fd), Size(Size) {}
+
+  // Closes the file. Its memory lives on for as long as it stays mapped.
+  ~ur_physical_mem_handle_t_();
+
+  const int Fd;
+  const size_t Size;
+};
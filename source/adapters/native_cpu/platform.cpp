@@ -34,8 +34,16 @@ urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
     return UR_RESULT_SUCCESS;
   }
   if (phPlatforms && NumEntries > 0) {
-    static ur_platform_handle_t_ ThePlatform;
-    *phPlatforms = &ThePlatform;
+    // Constructing the platform starts the worker threads of its device, and
+    // is tried again by the next call if that fails
+    try {
+      static ur_platform_handle_t_ ThePlatform;
+      *phPlatforms = &ThePlatform;
+    } catch (const std::bad_alloc &) {
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (...) {
+      return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+    }
   }
   return UR_RESULT_SUCCESS;
 }
@@ -12,9 +12,45 @@
 
 #include "common.hpp"
 #include "common/ur_util.hpp"
+#include "kernel.hpp"
 #include "program.hpp"
 #include <cstdint>
 #include <memory>
+#if defined(__linux__)
+#include <dlfcn.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ur_program_handle_t_::~ur_program_handle_t_() {
+  while (auto *kernel = popFreeKernel()) {
+    delete kernel;
+  }
+}
+
+ur_kernel_handle_t_ *ur_program_handle_t_::popFreeKernel() {
+  std::lock_guard<std::mutex> Lock(_freeKernelsMutex);
+  auto *kernel = _freeKernels;
+  if (kernel) {
+    _freeKernels = kernel->_nextFree;
+  }
+  return kernel;
+}
+
+void ur_program_handle_t_::pushFreeKernel(ur_kernel_handle_t_ *kernel) {
+  std::lock_guard<std::mutex> Lock(_freeKernelsMutex);
+  kernel->_nextFree = _freeKernels;
+  _freeKernels = kernel;
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
@@ -52,6 +88,106 @@ static ur_result_t getReqdWGSize(const ur_program_metadata_t &MetadataElement,
   return UR_RESULT_SUCCESS;
 }
 
+// Value of a byte array metadata, skipping the 64-bit size at its start.
+static std::string getByteArray(const ur_program_metadata_t &MetadataElement) {
+  const char *ValuePtr =
+      reinterpret_cast<const char *>(MetadataElement.value.pData) +
+      sizeof(std::uint64_t);
+  return std::string(ValuePtr, MetadataElement.size - sizeof(std::uint64_t));
+}
+
+#if defined(__linux__)
+// Sets the sizes in `Sizes`, keyed on the addresses of variables in the module
+// `Map`, from the module's symbol table. The static symbol table is read from
+// the module's file, as the dynamic one only has the exported symbols. If the
+// file has been stripped, the dynamic symbol table is used instead.
+static void readSymbolSizes(const link_map *Map,
+                            std::unordered_map<const void *, size_t> &Sizes) {
+  // The main program has no name in the link map
+  const char *Path = Map->l_name[0] ? Map->l_name : "/proc/self/exe";
+  int Fd = open(Path, O_RDONLY | O_CLOEXEC);
+  if (Fd < 0) {
+    return;
+  }
+  struct stat Stat;
+  void *File = MAP_FAILED;
+  if (fstat(Fd, &Stat) == 0 &&
+      static_cast<size_t>(Stat.st_size) >= sizeof(ElfW(Ehdr))) {
+    File = mmap(nullptr, Stat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+  }
+  close(Fd);
+  if (File == MAP_FAILED) {
+    return;
+  }
+
+  const size_t FileSize = Stat.st_size;
+  const auto *Base = static_cast<const unsigned char *>(File);
+  const auto *Header = static_cast<const ElfW(Ehdr) *>(File);
+  // Whether `Count` entries of `Size` bytes at `Offset` are within the file
+  auto InFile = [FileSize](size_t Offset, size_t Count, size_t Size) {
+    return Offset <= FileSize && Count <= (FileSize - Offset) / Size;
+  };
+  const ElfW(Shdr) *Symtab = nullptr;
+  if (std::memcmp(Header->e_ident, ELFMAG, SELFMAG) == 0 &&
+      Header->e_shentsize == sizeof(ElfW(Shdr)) &&
+      InFile(Header->e_shoff, Header->e_shnum, sizeof(ElfW(Shdr)))) {
+    const auto *Sections =
+        reinterpret_cast<const ElfW(Shdr) *>(Base + Header->e_shoff);
+    for (size_t i = 0; i < Header->e_shnum; i++) {
+      if (Sections[i].sh_type == SHT_SYMTAB ||
+          (Sections[i].sh_type == SHT_DYNSYM && Symtab == nullptr)) {
+        Symtab = &Sections[i];
+      }
+    }
+  }
+  if (Symtab && Symtab->sh_entsize == sizeof(ElfW(Sym)) &&
+      InFile(Symtab->sh_offset, Symtab->sh_size / sizeof(ElfW(Sym)),
+             sizeof(ElfW(Sym)))) {
+    const auto *Symbols =
+        reinterpret_cast<const ElfW(Sym) *>(Base + Symtab->sh_offset);
+    for (size_t i = 0; i < Symtab->sh_size / sizeof(ElfW(Sym)); i++) {
+      const auto &Symbol = Symbols[i];
+      if (ELF64_ST_TYPE(Symbol.st_info) != STT_OBJECT ||
+          Symbol.st_shndx == SHN_UNDEF || Symbol.st_size == 0) {
+        continue;
+      }
+      auto It = Sizes.find(
+          reinterpret_cast<const void *>(Map->l_addr + Symbol.st_value));
+      if (It != Sizes.end()) {
+        It->second = Symbol.st_size;
+      }
+    }
+  }
+  munmap(File, FileSize);
+}
+#endif
+
+// Sets the sizes in `Sizes`, keyed on the addresses of variables, to those of
+// the symbols that start at them, leaving 0 if none do. The device binary is
+// part of the host process, so its device globals are variables of the
+// modules loaded in it.
+static void getSymbolSizes(std::unordered_map<const void *, size_t> &Sizes) {
+#if defined(__linux__)
+  // Each module's symbol table is read once, for all the variables in it
+  std::vector<const link_map *> Modules;
+  for (const auto &[Ptr, Size] : Sizes) {
+    Dl_info Info;
+    link_map *Map = nullptr;
+    if (Size != 0 || dladdr1(Ptr, &Info, reinterpret_cast<void **>(&Map),
+                             RTLD_DL_LINKMAP) == 0) {
+      continue;
+    }
+    if (Map &&
+        std::find(Modules.begin(), Modules.end(), Map) == Modules.end()) {
+      Modules.push_back(Map);
+      readSymbolSizes(Map, Sizes);
+    }
+  }
+#else
+  std::ignore = Sizes;
+#endif
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     const uint8_t *pBinary, const ur_program_properties_t *pProperties,
@@ -66,6 +202,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
 
   auto hProgram = std::make_unique<ur_program_handle_t_>(
       hContext, reinterpret_cast<const unsigned char *>(pBinary));
+  std::unordered_map<std::string, native_cpu::ReqdWGSize_t> ReqdWGSizeMD;
+  // Unique id that the runtime uses for each device global, keyed on the
+  // symbol name
+  std::unordered_map<std::string, std::string> GlobalIDMD;
   if (pProperties != nullptr) {
     for (uint32_t i = 0; i < pProperties->count; i++) {
       const auto &mdNode = pProperties->pMetadatas[i];
@@ -77,19 +217,60 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
         if (res != UR_RESULT_SUCCESS) {
           return res;
         }
-        hProgram->KernelReqdWorkGroupSizeMD[Prefix] = std::move(reqdWGSize);
+        ReqdWGSizeMD[Prefix] = std::move(reqdWGSize);
+      } else if (Tag == __SYCL_UR_PROGRAM_METADATA_GLOBAL_ID_MAPPING) {
+        UR_ASSERT(mdNode.type == UR_PROGRAM_METADATA_TYPE_BYTE_ARRAY &&
+                      mdNode.size >= sizeof(std::uint64_t),
+                  UR_RESULT_ERROR_INVALID_VALUE);
+        GlobalIDMD[getByteArray(mdNode)] = Prefix;
       }
     }
   }
 
+  // Device globals are added once all their sizes are known
+  std::vector<native_cpu::global_entry_t> Globals;
+  std::unordered_map<const void *, size_t> GlobalSizes;
   const nativecpu_entry *nativecpu_it =
       reinterpret_cast<const nativecpu_entry *>(pBinary);
   while (nativecpu_it->kernel_ptr != nullptr) {
-    hProgram->_kernels.insert(
-        std::make_pair(nativecpu_it->kernelname, nativecpu_it->kernel_ptr));
+    auto GlobalIt = GlobalIDMD.find(nativecpu_it->kernelname);
+    if (GlobalIt != GlobalIDMD.end()) {
+      // Entries of device globals point at the variable rather than at code.
+      // The enqueue entry points look them up by unique id and
+      // urProgramGetGlobalVariablePointer by symbol name.
+      native_cpu::global_entry_t global{};
+      global.ptr = const_cast<unsigned char *>(nativecpu_it->kernel_ptr);
+      global.name = hProgram->_globalIds.emplace_back(GlobalIt->second);
+      Globals.push_back(global);
+      global.name = nativecpu_it->kernelname;
+      Globals.push_back(global);
+      GlobalSizes[global.ptr] = 0;
+      nativecpu_it++;
+      continue;
+    }
+    // Fold the metadata of each kernel into its entry, so that urKernelCreate
+    // only does the one lookup
+    native_cpu::kernel_entry_t entry{};
+    entry.name = nativecpu_it->kernelname;
+    entry.hash = native_cpu::kernel_table_t::hash(entry.name);
+    entry.ptr = nativecpu_it->kernel_ptr;
+    auto ReqdIt = ReqdWGSizeMD.find(nativecpu_it->kernelname);
+    if (ReqdIt != ReqdWGSizeMD.end()) {
+      entry.hasReqdWGSize = true;
+      entry.reqdWGSize = ReqdIt->second;
+    }
+    hProgram->_kernels.insert(entry);
     nativecpu_it++;
   }
 
+
+  getSymbolSizes(GlobalSizes);
+  for (auto &global : Globals) {
+    global.size = GlobalSizes[global.ptr];
+    global.hash = native_cpu::global_table_t::hash(global.name);
+    hProgram->_globals.insert(global);
+  }
+
   *phProgram = hProgram.release();
 
   return UR_RESULT_SUCCESS;
@@ -175,12 +356,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     ur_device_handle_t, ur_program_handle_t hProgram,
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
-  std::ignore = hProgram;
-  std::ignore = pGlobalVariableName;
-  std::ignore = pGlobalVariableSizeRet;
-  std::ignore = ppGlobalVariablePointerRet;
-
-  DIE_NO_IMPLEMENTATION
+  UR_ASSERT(hProgram, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalVariableName, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(ppGlobalVariablePointerRet, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  auto *global = hProgram->_globals.find(pGlobalVariableName);
+  UR_ASSERT(global, UR_RESULT_ERROR_INVALID_VALUE);
+  if (pGlobalVariableSizeRet) {
+    // Rather than report a size of 0
+    if (global->size == 0) {
+      logger::error("The size of device global {} isn't known",
+                    pGlobalVariableName);
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    *pGlobalVariableSizeRet = global->size;
+  }
+  *ppGlobalVariablePointerRet = global->ptr;
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -14,30 +14,131 @@
 
 #include "context.hpp"
 
+#include <algorithm>
 #include <array>
-#include <map>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct ur_kernel_handle_t_;
 
 namespace native_cpu {
 using ReqdWGSize_t = std::array<uint32_t, 3>;
-}
+
+// Everything urKernelCreate needs to know about a kernel of the program.
+struct kernel_entry_t {
+  size_t hash;
+  // Points at the NUL-terminated name in the binary
+  std::string_view name;
+  const unsigned char *ptr;
+  bool hasReqdWGSize;
+  ReqdWGSize_t reqdWGSize;
+};
+
+// Open-addressed hash table of the symbols of a program, keyed on their
+// name. It is built once when the program is created and is read-only after,
+// so lookups don't need a lock and don't allocate.
+template <typename EntryT> class symbol_table_t {
+public:
+  static size_t hash(std::string_view name) {
+    return std::hash<std::string_view>{}(name);
+  }
+
+  // Adds a symbol, unless one with the same name is already in the table.
+  void insert(const EntryT &entry) {
+    if ((_size + 1) * 2 > _slots.size()) {
+      grow();
+    }
+    auto &slot = _slots[probe(entry.hash, entry.name)];
+    if (!slot.ptr) {
+      slot = entry;
+      _size++;
+    }
+  }
+
+  const EntryT *find(std::string_view name) const {
+    if (_slots.empty()) {
+      return nullptr;
+    }
+    auto &slot = _slots[probe(hash(name), name)];
+    return slot.ptr ? &slot : nullptr;
+  }
+
+  size_t size() const { return _size; }
+
+private:
+  // Returns the index of the slot holding `name`, or of the empty slot it
+  // would go in.
+  size_t probe(size_t hash, std::string_view name) const {
+    const size_t mask = _slots.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+      auto &slot = _slots[i];
+      if (!slot.ptr || (slot.hash == hash && slot.name == name)) {
+        return i;
+      }
+    }
+  }
+
+  void grow() {
+    std::vector<EntryT> old(std::max<size_t>(_slots.size() * 2, 16));
+    old.swap(_slots);
+    for (auto &entry : old) {
+      if (entry.ptr) {
+        _slots[probe(entry.hash, entry.name)] = entry;
+      }
+    }
+  }
+
+  // Empty slots have a null `ptr`, the table is never more than half full
+  std::vector<EntryT> _slots;
+  size_t _size = 0;
+};
+
+using kernel_table_t = symbol_table_t<kernel_entry_t>;
+
+// A device global variable of the program. The binary is part of the host
+// process, so the variable is read and written in place.
+struct global_entry_t {
+  size_t hash;
+  std::string_view name;
+  unsigned char *ptr;
+  // In bytes, 0 if it isn't known
+  size_t size;
+};
+
+using global_table_t = symbol_table_t<global_entry_t>;
+} // namespace native_cpu
 
 struct ur_program_handle_t_ : RefCounted {
   ur_program_handle_t_(ur_context_handle_t ctx, const unsigned char *pBinary)
       : _ctx{ctx}, _ptr{pBinary} {}
 
+  // Frees the kernels on the free-list, the others hold a reference to the
+  // program so there are none left.
+  ~ur_program_handle_t_();
+
   uint32_t getReferenceCount() const noexcept { return _refCount; }
 
   ur_context_handle_t _ctx;
   const unsigned char *_ptr;
-  struct _compare {
-    bool operator()(char const *a, char const *b) const {
-      return std::strcmp(a, b) < 0;
-    }
-  };
+  native_cpu::kernel_table_t _kernels;
+  // Device globals, under both their unique id and their symbol name
+  native_cpu::global_table_t _globals;
+  // Storage for the unique ids, which come from the metadata
+  std::deque<std::string> _globalIds;
+
+  // Released kernels are kept for reuse by urKernelCreate, so that creating
+  // and releasing kernels doesn't allocate. They are linked through
+  // ur_kernel_handle_t_::_nextFree.
+  ur_kernel_handle_t_ *popFreeKernel();
+  void pushFreeKernel(ur_kernel_handle_t_ *kernel);
 
-  std::map<const char *, const unsigned char *, _compare> _kernels;
-  std::unordered_map<std::string, native_cpu::ReqdWGSize_t>
-      KernelReqdWorkGroupSizeMD;
+private:
+  std::mutex _freeKernelsMutex;
+  ur_kernel_handle_t_ *_freeKernels = nullptr;
 };
 
 // The nativecpu_entry struct is also defined as LLVM-IR in the
@@ -10,32 +10,271 @@
 
 #include "queue.hpp"
 #include "common.hpp"
+#include "event.hpp"
+#include "kernel_batch.hpp"
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
 
+#include <vector>
+
+namespace {
+// A command waiting for its dependencies. The count starts at one so that the
+// command can't be started before all the dependencies have been registered.
+struct pending_command_t {
+  pending_command_t(ur_event_handle_t event, native_cpu::command_body_t &&body)
+      : numPendingDeps(1), event(event), body(std::move(body)) {}
+
+  void dependencyCompleted() {
+    if (numPendingDeps.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      event->setSubmitted();
+      body(event);
+      delete this;
+    }
+  }
+
+  void addDependency(ur_event_handle_t dep) {
+    numPendingDeps.fetch_add(1, std::memory_order_relaxed);
+    if (!dep->whenComplete([this]() { this->dependencyCompleted(); })) {
+      // Already complete
+      numPendingDeps.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<uint32_t> numPendingDeps;
+  ur_event_handle_t event;
+  native_cpu::command_body_t body;
+};
+
+// A wait list has to be given along with a non-zero count, and hold no null
+// events.
+ur_result_t validateWaitList(uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList) {
+  if ((numEventsInWaitList == 0) != (phEventWaitList == nullptr)) {
+    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+  }
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    if (!phEventWaitList[i]) {
+      return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+ur_result_t ur_queue_handle_t_::enqueue(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    native_cpu::command_body_t &&body, bool blocking, ordering_t ordering,
+    native_cpu::kernel_batch_t *batch) {
+  if (auto Err = validateWaitList(numEventsInWaitList, phEventWaitList)) {
+    return Err;
+  }
+
+  // The reference the event is created with belongs to the command and is
+  // dropped once the command completes.
+  auto event = new ur_event_handle_t_(this, commandType);
+  if (phEvent) {
+    event->incrementReferenceCount();
+    *phEvent = event;
+  }
+  if (blocking) {
+    event->incrementReferenceCount();
+  }
+
+  auto command = new pending_command_t(event, std::move(body));
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    command->addDependency(phEventWaitList[i]);
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const bool afterAll =
+        ordering == ordering_t::AfterAll ||
+        (ordering == ordering_t::Barrier && numEventsInWaitList == 0);
+    if (!isInOrder() && afterAll) {
+      for (auto pending : pendingEvents) {
+        command->addDependency(pending);
+      }
+    } else if (lastEvent) {
+      command->addDependency(lastEvent);
+    }
+    event->incrementReferenceCount();
+    pendingEvents.insert(event);
+    if (isInOrder() || ordering == ordering_t::Barrier) {
+      lastEvent = event;
+    }
+    setOpenBatch(batch);
+  }
+  command->dependencyCompleted();
+
+  if (blocking) {
+    event->wait();
+    decrementOrDelete(event);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_queue_handle_t_::~ur_queue_handle_t_() { setOpenBatch(nullptr); }
+
+void ur_queue_handle_t_::setOpenBatch(native_cpu::kernel_batch_t *batch) {
+  if (batch) {
+    batch->incrementReferenceCount();
+  }
+  if (openBatch) {
+    decrementOrDelete(openBatch);
+  }
+  openBatch = batch;
+}
+
+ur_result_t ur_queue_handle_t_::enqueueBatchedLaunch(
+    native_cpu::kernel_launch_t *launch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  if (auto Err = validateWaitList(numEventsInWaitList, phEventWaitList)) {
+    delete launch;
+    return Err;
+  }
+
+  if (numEventsInWaitList == 0) {
+    auto event = new ur_event_handle_t_(this, UR_COMMAND_KERNEL_LAUNCH);
+    bool appended;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      appended = openBatch && openBatch->append(launch, event);
+      if (appended) {
+        // The batch completes the event in place of a command. It may already
+        // be running it, but can't drop the reference of the command before
+        // the mutex is released
+        if (phEvent) {
+          event->incrementReferenceCount();
+          *phEvent = event;
+        }
+        event->incrementReferenceCount();
+        pendingEvents.insert(event);
+        lastEvent = event;
+      }
+    }
+    if (appended) {
+      return UR_RESULT_SUCCESS;
+    }
+    delete event;
+  }
+
+  // Start a new batch, the reference it is created with belongs to the
+  // command and is dropped by start()
+  auto batch = new native_cpu::kernel_batch_t(device->tp, launch);
+  auto Result = enqueue(
+      UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList, phEventWaitList, phEvent,
+      [batch](ur_event_handle_t hEvent) { batch->start(hEvent); }, false,
+      ordering_t::Default, batch);
+  if (Result != UR_RESULT_SUCCESS) {
+    decrementOrDelete(batch);
+  }
+  return Result;
+}
+
+ur_result_t ur_queue_handle_t_::enqueueCommand(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    native_cpu::command_body_t &&body, bool blocking) {
+  return enqueue(commandType, numEventsInWaitList, phEventWaitList, phEvent,
+                 std::move(body), blocking, ordering_t::Default);
+}
+
+ur_result_t ur_queue_handle_t_::enqueueHostTask(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    std::function<void()> &&task, bool blocking) {
+  auto &tp = device->tp;
+  return enqueueCommand(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp, task = std::move(task)](ur_event_handle_t hEvent) {
+        tp.schedule([task, hEvent](size_t) {
+          hEvent->setRunning();
+          task();
+          hEvent->complete();
+        });
+      },
+      blocking);
+}
+
+ur_result_t ur_queue_handle_t_::enqueueMarker(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    bool isBarrier, bool blocking) {
+  return enqueue(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [](ur_event_handle_t hEvent) {
+        hEvent->setRunning();
+        hEvent->complete();
+      },
+      blocking,
+      isBarrier ? ordering_t::Barrier
+                : (numEventsInWaitList ? ordering_t::Default
+                                       : ordering_t::AfterAll));
+}
+
+void ur_queue_handle_t_::finish() {
+  std::vector<ur_event_handle_t> pending;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.reserve(pendingEvents.size());
+    for (auto event : pendingEvents) {
+      event->incrementReferenceCount();
+      pending.push_back(event);
+    }
+  }
+  for (auto event : pending) {
+    event->wait();
+    decrementOrDelete(event);
+  }
+}
+
+void ur_queue_handle_t_::eventCompleted(ur_event_handle_t hEvent) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!pendingEvents.erase(hEvent)) {
+      return;
+    }
+    if (lastEvent == hEvent) {
+      lastEvent = nullptr;
+    }
+  }
+  decrementOrDelete(hEvent);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
                                                    ur_queue_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hQueue;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hQueue->context);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(ur_device_handle_t{hQueue->device});
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(hQueue->flags);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(hQueue->getReferenceCount());
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pProperties;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phQueue, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  auto Queue = new ur_queue_handle_t_(hDevice);
+  ur_queue_flags_t flags = pProperties ? pProperties->flags : 0;
+  auto Queue = new ur_queue_handle_t_(hDevice, hContext, flags);
   *phQueue = Queue;
 
   return UR_RESULT_SUCCESS;
@@ -78,13 +317,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
-  // TODO: is this fine as no-op?
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hQueue->finish();
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  // Commands are handed to the thread pool as soon as their dependencies are
+  // met, so there is nothing to flush.
+  return UR_RESULT_SUCCESS;
 }
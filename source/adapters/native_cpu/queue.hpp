@@ -8,11 +8,109 @@
 //
 //===----------------------------------------------------------------------===//
 #pragma once
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+
 #include "common.hpp"
 #include "device.hpp"
+#include "event.hpp"
+
+namespace native_cpu {
+// Starts the work of a command whose dependencies have completed. The body
+// must not block, and must eventually call complete() on the event exactly
+// once, typically from the last thread pool task belonging to the command.
+using command_body_t = std::function<void(ur_event_handle_t)>;
+
+class kernel_batch_t;
+struct kernel_launch_t;
+} // namespace native_cpu
 
 struct ur_queue_handle_t_ : RefCounted {
   ur_device_handle_t_ *const device;
+  ur_context_handle_t const context;
+  const ur_queue_flags_t flags;
+
+  ur_queue_handle_t_(ur_device_handle_t_ *device, ur_context_handle_t context,
+                     ur_queue_flags_t flags)
+      : device(device), context(context), flags(flags) {}
+
+  ~ur_queue_handle_t_();
+
+  bool isInOrder() const noexcept {
+    return !(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+  }
+
+  // Enqueues a command that runs `body` once every event in the wait list has
+  // completed. On an in-order queue the command also waits for the previously
+  // enqueued command, on an out-of-order queue only for the last barrier. If
+  // `blocking` is set this only returns once the command itself has
+  // completed.
+  ur_result_t enqueueCommand(ur_command_t commandType,
+                             uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent,
+                             native_cpu::command_body_t &&body,
+                             bool blocking = false);
+
+  // Convenience wrapper around enqueueCommand for commands that consist of a
+  // single host function, which is executed on the device thread pool.
+  ur_result_t enqueueHostTask(ur_command_t commandType,
+                              uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent,
+                              std::function<void()> &&task,
+                              bool blocking = false);
+
+  // Enqueues a command with no work of its own. With an empty wait list it
+  // waits for every command enqueued so far. A barrier additionally makes
+  // every command enqueued after it wait for it.
+  ur_result_t enqueueMarker(ur_command_t commandType,
+                            uint32_t numEventsInWaitList,
+                            const ur_event_handle_t *phEventWaitList,
+                            ur_event_handle_t *phEvent, bool isBarrier,
+                            bool blocking = false);
+
+  // Enqueues a kernel launch on an in-order queue, taking ownership of
+  // `launch`. A launch with an empty wait list that directly follows another
+  // one joins its batch, see native_cpu::kernel_batch_t.
+  ur_result_t enqueueBatchedLaunch(native_cpu::kernel_launch_t *launch,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent);
+
+  // Waits for all the commands enqueued so far.
+  void finish();
+
+  // Called by events of this queue when their command completes.
+  void eventCompleted(ur_event_handle_t hEvent);
+
+private:
+  enum class ordering_t { Default, AfterAll, Barrier };
+
+  ur_result_t enqueue(ur_command_t commandType, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent,
+                      native_cpu::command_body_t &&body, bool blocking,
+                      ordering_t ordering,
+                      native_cpu::kernel_batch_t *batch = nullptr);
+
+  // Replaces openBatch, called with the mutex held.
+  void setOpenBatch(native_cpu::kernel_batch_t *batch);
+
+  std::mutex mutex;
+
+  // Commands that have been enqueued but have not completed yet. The queue
+  // holds a reference to each of them.
+  std::unordered_set<ur_event_handle_t> pendingEvents;
+
+  // Command that the next command has to wait for: the last enqueued command
+  // on an in-order queue, the last barrier on an out-of-order queue. Always
+  // either null or one of pendingEvents.
+  ur_event_handle_t lastEvent = nullptr;
 
-  ur_queue_handle_t_(ur_device_handle_t_ *device) : device(device) {}
+  // Batch of the last enqueued command, if it is a batched kernel launch.
+  // Launches can only join the batch while this is set, as they would
+  // otherwise run ahead of the commands enqueued after the batch.
+  native_cpu::kernel_batch_t *openBatch = nullptr;
 };
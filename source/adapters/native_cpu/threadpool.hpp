@@ -9,40 +9,243 @@
 #pragma once
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <forward_list>
 #include <functional>
 #include <future>
 #include <iterator>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <numeric>
 #include <queue>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "topology.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace native_cpu {
 
 using worker_task_t = std::function<void(size_t)>;
 
 namespace detail {
 
+inline size_t get_num_threads() {
+  size_t numThreads;
+  char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
+  if (envVar) {
+    numThreads = std::stoul(envVar);
+  } else {
+    numThreads = std::thread::hardware_concurrency();
+  }
+  return std::max<size_t>(numThreads, 1);
+}
+
+// Hints to the CPU that the thread is polling, which saves power and leaves
+// the core to the other hardware thread.
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+// Polls `ready` until it returns true, for threads that have no condition
+// variable to sleep on. Pauses for the first polls and then yields.
+template <typename ReadyT> void spin_until(ReadyT &&ready) {
+  for (unsigned polls = 0; !ready(); polls++) {
+    if (polls < 256) {
+      cpu_relax();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// How workers that run out of tasks wait for new ones, set with
+// SYCL_NATIVE_CPU_HOST_WAIT_POLICY=<mode>[:<spin time in microseconds>]:
+//  - "park" puts them to sleep straight away, so that every task scheduled
+//    to an idle worker pays for waking a thread;
+//  - "spin" polls for the spin time before parking, pausing for the first
+//    half and yielding the CPU for the second;
+//  - "adaptive", the default, polls like "spin" but for about twice as long
+//    as the worker has recently been idle for, and parks straight away when
+//    tasks come further apart than the spin time.
+// The spin time defaults to 50us.
+struct wait_policy_t {
+  enum class mode_t { park, spin, adaptive };
+
+  static constexpr std::chrono::microseconds defaultSpinTime{50};
+  // Longest spin time accepted from the environment
+  static constexpr std::chrono::microseconds maxSpinTime{1000000};
+
+  mode_t mode = mode_t::adaptive;
+  std::chrono::nanoseconds spinTime = defaultSpinTime;
+
+  // Reads a policy in the format above, or returns the default policy if
+  // `text` is null or malformed.
+  static wait_policy_t parse(const char *text) {
+    wait_policy_t policy;
+    if (!text) {
+      return policy;
+    }
+    const char *colon = std::strchr(text, ':');
+    const std::string mode =
+        colon ? std::string(text, colon) : std::string(text);
+    if (mode == "park") {
+      policy.mode = mode_t::park;
+    } else if (mode == "spin") {
+      policy.mode = mode_t::spin;
+    } else if (mode != "adaptive") {
+      return wait_policy_t{};
+    }
+    if (colon) {
+      char *end = nullptr;
+      const unsigned long long us = std::strtoull(colon + 1, &end, 10);
+      if (end == colon + 1 || *end != '\0') {
+        return wait_policy_t{};
+      }
+      policy.spinTime = std::chrono::microseconds(std::min<unsigned long long>(
+          us, static_cast<unsigned long long>(maxSpinTime.count())));
+    }
+    return policy;
+  }
+
+  static wait_policy_t from_environment() {
+    return parse(std::getenv("SYCL_NATIVE_CPU_HOST_WAIT_POLICY"));
+  }
+};
+
+// Waits of a single worker for new tasks, following a wait_policy_t. Keeps a
+// moving average of how long the worker stays idle, from which the adaptive
+// policy sizes its spin budget.
+class idle_waiter_t {
+public:
+  using clock_type = std::chrono::steady_clock;
+
+  explicit idle_waiter_t(const wait_policy_t &policy) noexcept
+      : m_policy(policy), m_averageIdle(policy.spinTime / 2) {}
+
+  // How long the next wait polls for before parking.
+  std::chrono::nanoseconds spin_budget() const noexcept {
+    switch (m_policy.mode) {
+    case wait_policy_t::mode_t::park:
+      return std::chrono::nanoseconds(0);
+    case wait_policy_t::mode_t::spin:
+      return m_policy.spinTime;
+    case wait_policy_t::mode_t::adaptive:
+      // Tasks that come further apart would be missed by the spin anyway
+      if (m_averageIdle > m_policy.spinTime) {
+        return std::chrono::nanoseconds(0);
+      }
+      return std::min(2 * m_averageIdle, m_policy.spinTime);
+    }
+    return std::chrono::nanoseconds(0);
+  }
+
+  // Called by the worker when it runs out of tasks. Polls `ready` until it
+  // returns true or the spin budget runs out, and returns whether it did. If
+  // not the worker should park.
+  template <typename ReadyT> bool spin(ReadyT &&ready) {
+    const auto now = clock_type::now();
+    if (!m_isIdle) {
+      m_isIdle = true;
+      m_idleSince = now;
+    }
+    const auto budget = spin_budget();
+    if (budget.count() == 0) {
+      return ready();
+    }
+    const auto yieldAfter = now + budget / 2;
+    const auto deadline = now + budget;
+    bool yielding = false;
+    for (unsigned polls = 1; !ready(); polls++) {
+      // Reading the clock costs more than a poll
+      if (polls % 16 == 0) {
+        const auto time = clock_type::now();
+        if (time >= deadline) {
+          return false;
+        }
+        yielding = time >= yieldAfter;
+      }
+      if (yielding) {
+        std::this_thread::yield();
+      } else {
+        cpu_relax();
+      }
+    }
+    return true;
+  }
+
+  // Called by the worker when it picks up a task, to learn how long it was
+  // idle for, whether it parked or not.
+  void found_work() noexcept {
+    if (!m_isIdle) {
+      return;
+    }
+    m_isIdle = false;
+    if (m_policy.mode != wait_policy_t::mode_t::adaptive) {
+      return;
+    }
+    // Capped so that a single long pause doesn't stop the worker from
+    // spinning for long once tasks come close together again
+    const std::chrono::nanoseconds idle = std::min<std::chrono::nanoseconds>(
+        clock_type::now() - m_idleSince, 2 * m_policy.spinTime);
+    m_averageIdle += (idle - m_averageIdle) / 8;
+  }
+
+private:
+  const wait_policy_t m_policy;
+  std::chrono::nanoseconds m_averageIdle;
+  clock_type::time_point m_idleSince;
+  bool m_isIdle = false;
+};
+
 class worker_thread {
 public:
   // Initializes state, but does not start the worker thread
-  worker_thread(size_t threadId) noexcept
+  worker_thread(size_t threadId, const worker_placement_t &placement,
+                const wait_policy_t &waitPolicy) noexcept
       : m_threadId(threadId), m_isRunning(false), m_numTasks(0) {
     std::lock_guard<std::mutex> lock(m_workMutex);
     if (this->is_running()) {
       return;
     }
-    m_worker = std::thread([this]() {
+    m_worker = std::thread([this, &placement, waitPolicy]() {
+      placement.pin(m_threadId);
+      idle_waiter_t waiter(waitPolicy);
+      auto hasWork = [this]() {
+        return !this->is_running() || !m_tasks.empty();
+      };
       while (true) {
+        if (m_numTasks.load(std::memory_order_acquire) == 0) {
+          // Poll for new tasks before parking, m_numTasks only counts the
+          // queued tasks here
+          waiter.spin([this]() {
+            return m_numTasks.load(std::memory_order_acquire) > 0 ||
+                   !this->is_running();
+          });
+        }
         std::unique_lock<std::mutex> lock(m_workMutex);
         // Wait until there's work available
-        m_startWorkCondition.wait(
-            lock, [this]() { return !this->is_running() || !m_tasks.empty(); });
+        if (!hasWork()) {
+          m_isParked = true;
+          m_startWorkCondition.wait(lock, hasWork);
+          m_isParked = false;
+        }
         if (!this->is_running() && m_tasks.empty()) {
           // Can only break if there is no more work to be done
           break;
@@ -55,6 +258,7 @@ public:
         lock.unlock();
 
         // Execute the task
+        waiter.found_work();
         task(m_threadId);
         --m_numTasks;
       }
@@ -64,13 +268,18 @@ public:
   }
 
   inline void schedule(const worker_task_t &task) {
+    bool isParked;
     {
       std::lock_guard<std::mutex> lock(m_workMutex);
       // Add the task to the queue
       m_tasks.push(task);
       ++m_numTasks;
+      isParked = m_isParked;
+    }
+    // A worker that is still spinning picks the task up without being woken
+    if (isParked) {
+      m_startWorkCondition.notify_one();
     }
-    m_startWorkCondition.notify_one();
   }
 
   size_t num_pending_tasks() const noexcept {
@@ -109,6 +318,9 @@ private:
   std::queue<worker_task_t> m_tasks;
 
   std::atomic<size_t> m_numTasks;
+
+  // Whether the worker is waiting on m_startWorkCondition, under m_workMutex
+  bool m_isParked = false;
 };
 
 // Implementation of a thread pool. The worker threads are created and
@@ -118,9 +330,18 @@ private:
 class simple_thread_pool {
 public:
   simple_thread_pool() noexcept
-      : m_isRunning(false), m_numThreads(get_num_threads()) {
+      : simple_thread_pool(
+            worker_placement_t::from_environment(get_num_threads())) {}
+
+  // One worker per entry of `placement`.
+  explicit simple_thread_pool(
+      worker_placement_t placement,
+      const wait_policy_t &waitPolicy =
+          wait_policy_t::from_environment()) noexcept
+      : m_isRunning(false), m_numThreads(placement.num_workers()),
+        m_placement(std::move(placement)) {
     for (size_t i = 0; i < m_numThreads; i++) {
-      m_workers.emplace_front(i);
+      m_workers.emplace_front(i, m_placement, waitPolicy);
     }
     m_isRunning.store(true, std::memory_order_release);
   }
@@ -143,6 +364,8 @@ public:
 
   inline size_t num_threads() const noexcept { return m_numThreads; }
 
+  const worker_placement_t &placement() const noexcept { return m_placement; }
+
   inline size_t num_pending_tasks() const noexcept {
     return std::accumulate(std::begin(m_workers), std::end(m_workers),
                            size_t(0),
@@ -152,9 +375,7 @@ public:
   }
 
   void wait_for_all_pending_tasks() {
-    while (num_pending_tasks() > 0) {
-      std::this_thread::yield();
-    }
+    spin_until([this]() { return num_pending_tasks() == 0; });
   }
 
 protected:
@@ -171,32 +392,507 @@ protected:
   }
 
 private:
-  static size_t get_num_threads() {
-    size_t numThreads;
-    char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
-    if (envVar) {
-      numThreads = std::stoul(envVar);
+  std::forward_list<worker_thread> m_workers;
+
+  std::atomic<bool> m_isRunning;
+
+  const size_t m_numThreads;
+
+  const worker_placement_t m_placement;
+};
+
+// Work item of the work-stealing pool. Nodes are linked through `next` while
+// they sit in a worker's inbox.
+struct ws_task {
+  ws_task(const worker_task_t &task) : task(task), next(nullptr) {}
+  worker_task_t task;
+  ws_task *next;
+};
+
+// Chase-Lev work-stealing deque ("Correct and Efficient Work-Stealing for
+// Weak Memory Models", Le et al.). The owning worker pushes and pops at the
+// bottom without taking any locks, other workers steal from the top.
+class ws_deque {
+public:
+  ws_deque() : m_top(0), m_bottom(0), m_array(new ring(initialCapacity)) {}
+
+  ~ws_deque() { delete m_array.load(std::memory_order_relaxed); }
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  // Only called by the owner
+  void push(ws_task *task) {
+    int64_t b = m_bottom.load(std::memory_order_relaxed);
+    int64_t t = m_top.load(std::memory_order_acquire);
+    ring *a = m_array.load(std::memory_order_relaxed);
+    if (b - t > a->capacity() - 1) {
+      ring *grown = a->grow(b, t);
+      // Thieves may still be reading from the old ring, so it is retired
+      // rather than freed. Rings only ever double, so this is bounded.
+      m_retired.emplace_back(a);
+      m_array.store(grown, std::memory_order_release);
+      a = grown;
+    }
+    a->put(b, task);
+    m_bottom.store(b + 1, std::memory_order_release);
+  }
+
+  // Only called by the owner
+  ws_task *pop() {
+    int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    ring *a = m_array.load(std::memory_order_relaxed);
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = m_top.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    ws_task *task = a->get(b);
+    if (t == b) {
+      // Last element, race against the thieves for it
+      if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+        task = nullptr;
+      }
+      m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Can be called by any thread
+  ws_task *steal() {
+    int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = m_bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    ring *a = m_array.load(std::memory_order_acquire);
+    ws_task *task = a->get(t);
+    if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      // Lost the race against another thief or the owner
+      return nullptr;
+    }
+    return task;
+  }
+
+  bool empty() const noexcept {
+    return m_bottom.load(std::memory_order_relaxed) <=
+           m_top.load(std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr int64_t initialCapacity = 64;
+
+  class ring {
+  public:
+    ring(int64_t capacity)
+        : m_mask(capacity - 1),
+          m_data(new std::atomic<ws_task *>[static_cast<size_t>(capacity)]) {}
+
+    int64_t capacity() const noexcept { return m_mask + 1; }
+
+    ws_task *get(int64_t i) const noexcept {
+      return m_data[i & m_mask].load(std::memory_order_relaxed);
+    }
+
+    void put(int64_t i, ws_task *task) noexcept {
+      m_data[i & m_mask].store(task, std::memory_order_relaxed);
+    }
+
+    ring *grow(int64_t bottom, int64_t top) const {
+      ring *grown = new ring(capacity() * 2);
+      for (int64_t i = top; i < bottom; i++) {
+        grown->put(i, get(i));
+      }
+      return grown;
+    }
+
+  private:
+    const int64_t m_mask;
+    std::unique_ptr<std::atomic<ws_task *>[]> m_data;
+  };
+
+  std::atomic<int64_t> m_top;
+  std::atomic<int64_t> m_bottom;
+  std::atomic<ring *> m_array;
+  std::vector<std::unique_ptr<ring>> m_retired;
+};
+
+// Thread pool where every worker owns a lock-free deque. Tasks scheduled from
+// outside the pool are handed round-robin to the workers' inboxes, tasks
+// scheduled from within a worker go straight to that worker's deque. Workers
+// that run out of work steal from random victims and park on a condition
+// variable when there is nothing left to steal.
+class work_stealing_thread_pool {
+public:
+  work_stealing_thread_pool()
+      : work_stealing_thread_pool(
+            worker_placement_t::from_environment(get_num_threads())) {}
+
+  // One worker per entry of `placement`. Throws std::bad_alloc or
+  // std::system_error if the workers can't be set up.
+  explicit work_stealing_thread_pool(
+      worker_placement_t placement,
+      const wait_policy_t &waitPolicy = wait_policy_t::from_environment())
+      : m_isRunning(true), m_numThreads(placement.num_workers()),
+        m_placement(std::move(placement)), m_waitPolicy(waitPolicy),
+        m_workers(new worker[m_numThreads]), m_numTasks(0), m_nextWorker(0),
+        m_wakeEpoch(0), m_numParked(0) {
+    try {
+      m_threads.reserve(m_numThreads);
+      for (size_t i = 0; i < m_numThreads; i++) {
+        m_threads.emplace_back([this, i]() { this->run(i); });
+      }
+    } catch (...) {
+      // The destructor won't run, so stop the workers that did start
+      stop();
+      throw;
+    }
+  }
+
+  ~work_stealing_thread_pool() { stop(); }
+
+  inline void schedule(const worker_task_t &task) {
+    auto node = new ws_task(task);
+    m_numTasks.fetch_add(1, std::memory_order_relaxed);
+    if (tl_currentPool == this) {
+      m_workers[tl_currentWorker].deque.push(node);
     } else {
-      numThreads = std::thread::hardware_concurrency();
+      auto &target =
+          m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                    m_numThreads];
+      target.push_inbox(node);
     }
-    return numThreads;
+    wake_one();
   }
 
-  std::forward_list<worker_thread> m_workers;
+  inline bool is_running() const noexcept {
+    return m_isRunning.load(std::memory_order_acquire);
+  }
+
+  inline size_t num_threads() const noexcept { return m_numThreads; }
+
+  const worker_placement_t &placement() const noexcept { return m_placement; }
+
+  inline size_t num_pending_tasks() const noexcept {
+    return m_numTasks.load(std::memory_order_acquire);
+  }
+
+  void wait_for_all_pending_tasks() {
+    spin_until([this]() { return num_pending_tasks() == 0; });
+  }
+
+private:
+  // Number of steal attempts made before a worker goes to sleep
+  static constexpr size_t stealRounds = 4;
+
+  struct alignas(64) worker {
+    ws_deque deque;
+
+    // Lock-free LIFO of tasks scheduled from outside the pool. Other threads
+    // can only take the whole list at once, which sidesteps the ABA problem.
+    std::atomic<ws_task *> inbox{nullptr};
+
+    // xorshift state for picking steal victims
+    uint64_t rngState = 0;
+
+    void push_inbox(ws_task *task) noexcept {
+      task->next = inbox.load(std::memory_order_relaxed);
+      while (!inbox.compare_exchange_weak(task->next, task,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+      }
+    }
+
+    ws_task *take_inbox() noexcept {
+      if (inbox.load(std::memory_order_relaxed) == nullptr) {
+        return nullptr;
+      }
+      return inbox.exchange(nullptr, std::memory_order_acquire);
+    }
+  };
+
+  // Moves a list taken from an inbox into the deque of worker `self`, and
+  // returns one of the tasks to execute straight away.
+  ws_task *adopt(size_t self, ws_task *list) {
+    ws_task *first = list;
+    list = list->next;
+    while (list) {
+      ws_task *next = list->next;
+      m_workers[self].deque.push(list);
+      list = next;
+    }
+    return first;
+  }
+
+  // Waits for the workers to drain all pending tasks and joins them.
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(m_parkMutex);
+      m_isRunning.store(false, std::memory_order_release);
+    }
+    m_parkCondition.notify_all();
+    for (auto &t : m_threads) {
+      t.join();
+    }
+  }
+
+  size_t random_victim(size_t self) noexcept {
+    uint64_t &x = m_workers[self].rngState;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return static_cast<size_t>(x % m_numThreads);
+  }
+
+  ws_task *find_task(size_t self) {
+    if (ws_task *task = m_workers[self].deque.pop()) {
+      return task;
+    }
+    if (ws_task *list = m_workers[self].take_inbox()) {
+      return adopt(self, list);
+    }
+    for (size_t round = 0; round < stealRounds * m_numThreads; round++) {
+      if (ws_task *task = steal_from(self, random_victim(self))) {
+        return task;
+      }
+    }
+    // Random victims may miss the one worker that still has work, so sweep
+    // all of them once before giving up and parking.
+    for (size_t victim = 0; victim < m_numThreads; victim++) {
+      if (ws_task *task = steal_from(self, victim)) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  ws_task *steal_from(size_t self, size_t victim) {
+    if (victim == self) {
+      return nullptr;
+    }
+    if (ws_task *task = m_workers[victim].deque.steal()) {
+      return task;
+    }
+    if (ws_task *list = m_workers[victim].take_inbox()) {
+      return adopt(self, list);
+    }
+    return nullptr;
+  }
+
+  void wake_one() {
+    m_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_numParked.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(m_parkMutex);
+      m_parkCondition.notify_one();
+    }
+  }
+
+  void run(size_t self) {
+    m_placement.pin(self);
+    tl_currentPool = this;
+    tl_currentWorker = self;
+    m_workers[self].rngState = 0x9E3779B97F4A7C15ull * (self + 1);
+    idle_waiter_t waiter(m_waitPolicy);
+    while (true) {
+      // Read the epoch before looking for work, so that a task scheduled
+      // after a failed search always prevents the worker from parking.
+      const uint64_t epoch = m_wakeEpoch.load(std::memory_order_seq_cst);
+      if (ws_task *task = find_task(self)) {
+        waiter.found_work();
+        task->task(self);
+        delete task;
+        m_numTasks.fetch_sub(1, std::memory_order_release);
+        continue;
+      }
+      if (!is_running() && num_pending_tasks() == 0) {
+        break;
+      }
+      // Poll for new tasks before parking, schedule() only has to wake
+      // workers that are parked
+      if (waiter.spin([this, epoch]() {
+            return m_wakeEpoch.load(std::memory_order_acquire) != epoch ||
+                   !is_running();
+          })) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(m_parkMutex);
+      m_numParked.fetch_add(1, std::memory_order_seq_cst);
+      m_parkCondition.wait(lock, [this, epoch]() {
+        return m_wakeEpoch.load(std::memory_order_seq_cst) != epoch ||
+               !is_running();
+      });
+      m_numParked.fetch_sub(1, std::memory_order_relaxed);
+    }
+    tl_currentPool = nullptr;
+  }
+
+  static inline thread_local work_stealing_thread_pool *tl_currentPool =
+      nullptr;
+  static inline thread_local size_t tl_currentWorker = 0;
 
   std::atomic<bool> m_isRunning;
 
   const size_t m_numThreads;
+
+  const worker_placement_t m_placement;
+
+  const wait_policy_t m_waitPolicy;
+
+  std::unique_ptr<worker[]> m_workers;
+
+  std::vector<std::thread> m_threads;
+
+  std::atomic<size_t> m_numTasks;
+
+  std::atomic<size_t> m_nextWorker;
+
+  std::mutex m_parkMutex;
+
+  std::condition_variable m_parkCondition;
+
+  std::atomic<uint64_t> m_wakeEpoch;
+
+  std::atomic<size_t> m_numParked;
+};
+
+// Forwards to the pool implementation selected by
+// SYCL_NATIVE_CPU_HOST_SCHEDULER ("simple", the default, or "work_stealing").
+class selectable_thread_pool {
+public:
+  selectable_thread_pool() {
+    if (use_work_stealing()) {
+      m_workStealing = std::make_unique<work_stealing_thread_pool>();
+    } else {
+      m_simple = std::make_unique<simple_thread_pool>();
+    }
+  }
+
+  explicit selectable_thread_pool(worker_placement_t placement) {
+    if (use_work_stealing()) {
+      m_workStealing =
+          std::make_unique<work_stealing_thread_pool>(std::move(placement));
+    } else {
+      m_simple = std::make_unique<simple_thread_pool>(std::move(placement));
+    }
+  }
+
+  inline void schedule(const worker_task_t &task) {
+    if (m_workStealing) {
+      m_workStealing->schedule(task);
+    } else {
+      m_simple->schedule(task);
+    }
+  }
+
+  inline size_t num_threads() const noexcept {
+    return m_workStealing ? m_workStealing->num_threads()
+                          : m_simple->num_threads();
+  }
+
+  const worker_placement_t &placement() const noexcept {
+    return m_workStealing ? m_workStealing->placement()
+                          : m_simple->placement();
+  }
+
+  inline size_t num_pending_tasks() const noexcept {
+    return m_workStealing ? m_workStealing->num_pending_tasks()
+                          : m_simple->num_pending_tasks();
+  }
+
+  void wait_for_all_pending_tasks() {
+    if (m_workStealing) {
+      m_workStealing->wait_for_all_pending_tasks();
+    } else {
+      m_simple->wait_for_all_pending_tasks();
+    }
+  }
+
+private:
+  static bool use_work_stealing() {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_SCHEDULER");
+    return envVar && std::strcmp(envVar, "work_stealing") == 0;
+  }
+
+  std::unique_ptr<simple_thread_pool> m_simple;
+  std::unique_ptr<work_stealing_thread_pool> m_workStealing;
 };
 } // namespace detail
 
+// Scratch memory owned by a single worker thread, which holds the local
+// memory of the work-groups that the worker executes. The buffer only grows,
+// so once warmed up launches don't allocate.
+class alignas(64) local_arena_t {
+public:
+  static constexpr size_t alignment = 64;
+
+  local_arena_t() = default;
+  local_arena_t(const local_arena_t &) = delete;
+  local_arena_t &operator=(const local_arena_t &) = delete;
+
+  ~local_arena_t() { release(); }
+
+  // Returns a buffer of at least `size` bytes, aligned to `alignment`. The
+  // contents are not preserved from one call to the next.
+  void *get(size_t size) {
+    if (size > m_capacity) {
+      release();
+      size_t capacity = std::max(size, 2 * m_capacity);
+      capacity = (capacity + alignment - 1) / alignment * alignment;
+      m_data = ::operator new(capacity, std::align_val_t(alignment));
+      m_capacity = capacity;
+    }
+    return m_data;
+  }
+
+private:
+  void release() {
+    if (m_data) {
+      ::operator delete(m_data, std::align_val_t(alignment));
+    }
+    m_data = nullptr;
+    m_capacity = 0;
+  }
+
+  void *m_data = nullptr;
+  size_t m_capacity = 0;
+};
+
 template <typename ThreadPoolT> class threadpool_interface {
+  // Declared first so that the arenas outlive the workers
+  std::unique_ptr<local_arena_t[]> arenas;
   ThreadPoolT threadpool;
 
 public:
   size_t num_threads() const noexcept { return threadpool.num_threads(); }
 
-  threadpool_interface() : threadpool() {}
+  // Where the workers run, see SYCL_NATIVE_CPU_HOST_AFFINITY.
+  const worker_placement_t &placement() const noexcept {
+    return threadpool.placement();
+  }
+
+  threadpool_interface() : threadpool() {
+    arenas.reset(new local_arena_t[threadpool.num_threads()]);
+  }
+
+  // Pool with the workers placed by `placement` rather than by the
+  // environment, as used by sub-devices.
+  explicit threadpool_interface(worker_placement_t placement)
+      : threadpool(std::move(placement)) {
+    arenas.reset(new local_arena_t[threadpool.num_threads()]);
+  }
+
+  // Arena of the worker `threadId`, only to be used from that worker.
+  local_arena_t &local_arena(size_t threadId) { return arenas[threadId]; }
+
+  // Schedules a task without tracking its completion, the task is expected to
+  // signal completion itself.
+  void schedule(worker_task_t &&task) { threadpool.schedule(task); }
 
   auto schedule_task(worker_task_t &&task) {
     auto workerTask = std::make_shared<std::packaged_task<void(size_t)>>(
@@ -206,6 +902,6 @@ public:
   }
 };
 
-using threadpool_t = threadpool_interface<detail::simple_thread_pool>;
+using threadpool_t = threadpool_interface<detail::selectable_thread_pool>;
 
 } // namespace native_cpu
@@ -0,0 +1,382 @@
+//===----------- topology.hpp - Native CPU Adapter ------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+// Placement of the thread pool workers on the CPUs and NUMA nodes of the host.
+// With SYCL_NATIVE_CPU_HOST_AFFINITY=numa the workers are pinned to CPUs read
+// from /sys/devices/system/node, and each NUMA node gets a contiguous range of
+// worker ids. Otherwise the workers float and the host is seen as one node.
+//
+// Also probes the memory, caches and vector units reported as device info.
+
+namespace native_cpu {
+
+// Parses a sysfs CPU or node list, such as "0-3,8,10-11". Returns the ids in
+// ascending order, and stops at the first malformed entry.
+inline std::vector<unsigned> parse_cpu_list(const std::string &list) {
+  std::vector<unsigned> ids;
+  const char *p = list.c_str();
+  while (*p) {
+    char *end = nullptr;
+    const unsigned long first = std::strtoul(p, &end, 10);
+    if (end == p) {
+      break;
+    }
+    unsigned long last = first;
+    p = end;
+    if (*p == '-') {
+      last = std::strtoul(p + 1, &end, 10);
+      if (end == p + 1 || last < first) {
+        break;
+      }
+      p = end;
+    }
+    for (unsigned long id = first; id <= last; id++) {
+      ids.push_back(static_cast<unsigned>(id));
+    }
+    if (*p != ',') {
+      break;
+    }
+    p++;
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+  return ids;
+}
+
+struct numa_node_t {
+  unsigned id;
+  std::vector<unsigned> cpus;
+};
+
+// Reads the NUMA nodes from `nodeDir`, which has the layout of
+// /sys/devices/system/node. Only the CPUs in `allowedCpus` are kept, unless it
+// is empty, and nodes left without CPUs are dropped. Returns an empty vector
+// if the topology can't be read.
+inline std::vector<numa_node_t>
+read_numa_nodes(const std::string &nodeDir,
+                const std::vector<unsigned> &allowedCpus) {
+  std::vector<numa_node_t> nodes;
+  std::ifstream online(nodeDir + "/online");
+  std::string list;
+  if (!std::getline(online, list)) {
+    return nodes;
+  }
+  for (unsigned id : parse_cpu_list(list)) {
+    std::ifstream cpuList(nodeDir + "/node" + std::to_string(id) + "/cpulist");
+    std::string cpus;
+    if (!std::getline(cpuList, cpus)) {
+      continue;
+    }
+    numa_node_t node{id, {}};
+    for (unsigned cpu : parse_cpu_list(cpus)) {
+      if (allowedCpus.empty() || std::binary_search(allowedCpus.begin(),
+                                                    allowedCpus.end(), cpu)) {
+        node.cpus.push_back(cpu);
+      }
+    }
+    if (!node.cpus.empty()) {
+      nodes.push_back(std::move(node));
+    }
+  }
+  return nodes;
+}
+
+// CPUs the process may run on, in ascending order. Empty if unknown.
+inline std::vector<unsigned> allowed_cpus() {
+  std::vector<unsigned> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+// Pins the calling thread to `cpu`. Returns false if that isn't supported or
+// fails, in which case the thread keeps floating.
+inline bool pin_current_thread(unsigned cpu) {
+#ifdef __linux__
+  if (cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+// NUMA nodes of the host with the CPUs the process may run on. Without NUMA
+// information all of them are on a single node.
+inline std::vector<numa_node_t> host_numa_nodes() {
+  auto nodes = read_numa_nodes("/sys/devices/system/node", allowed_cpus());
+  if (nodes.empty()) {
+    nodes.push_back({0, allowed_cpus()});
+  }
+  return nodes;
+}
+
+// Where each worker of a thread pool runs.
+class worker_placement_t {
+public:
+  // Floating workers, all on a single node.
+  explicit worker_placement_t(size_t numWorkers) : m_nodeWorkers{numWorkers} {}
+
+  // Spreads the workers evenly over the CPUs of `nodes`, taken in order, so
+  // that every node gets a contiguous range of worker ids in proportion to
+  // its CPUs. Workers share CPUs if there are more of them than CPUs. Nodes
+  // left without workers are dropped.
+  worker_placement_t(const std::vector<numa_node_t> &nodes,
+                     size_t numWorkers) {
+    std::vector<unsigned> cpus;
+    std::vector<size_t> cpuNodes;
+    for (size_t node = 0; node < nodes.size(); node++) {
+      for (unsigned cpu : nodes[node].cpus) {
+        cpus.push_back(cpu);
+        cpuNodes.push_back(node);
+      }
+    }
+    if (cpus.empty()) {
+      m_nodeWorkers.assign(1, numWorkers);
+      return;
+    }
+    size_t lastNode = cpuNodes.size();
+    for (size_t worker = 0; worker < numWorkers; worker++) {
+      const size_t cpu = worker * cpus.size() / numWorkers;
+      if (cpuNodes[cpu] != lastNode) {
+        lastNode = cpuNodes[cpu];
+        m_nodeIds.push_back(nodes[lastNode].id);
+        m_nodeWorkers.push_back(0);
+      }
+      m_cpus.push_back(cpus[cpu]);
+      m_nodes.push_back(m_nodeWorkers.size() - 1);
+      m_nodeWorkers.back()++;
+    }
+  }
+
+  // Reads SYCL_NATIVE_CPU_HOST_AFFINITY. "numa" pins the workers following
+  // the host topology, anything else leaves them floating.
+  static worker_placement_t from_environment(size_t numWorkers) {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_AFFINITY");
+    if (!envVar || std::strcmp(envVar, "numa") != 0) {
+      return worker_placement_t(numWorkers);
+    }
+    // Without NUMA information the workers can still be pinned.
+    return worker_placement_t(host_numa_nodes(), numWorkers);
+  }
+
+  bool is_pinned() const noexcept { return !m_cpus.empty(); }
+
+  size_t num_workers() const noexcept {
+    return is_pinned() ? m_cpus.size() : m_nodeWorkers[0];
+  }
+
+  size_t num_nodes() const noexcept { return m_nodeWorkers.size(); }
+
+  size_t node_of(size_t worker) const noexcept {
+    return is_pinned() ? m_nodes[worker] : 0;
+  }
+
+  size_t num_node_workers(size_t node) const noexcept {
+    return m_nodeWorkers[node];
+  }
+
+  // CPU of a pinned worker.
+  unsigned cpu_of(size_t worker) const noexcept { return m_cpus[worker]; }
+
+  // The nodes with one CPU entry per worker, so CPUs repeat if there are more
+  // workers than CPUs. Floating workers are numbered on a single node.
+  std::vector<numa_node_t> worker_nodes() const {
+    std::vector<numa_node_t> nodes;
+    if (!is_pinned()) {
+      nodes.push_back({0, {}});
+      for (size_t worker = 0; worker < m_nodeWorkers[0]; worker++) {
+        nodes.back().cpus.push_back(static_cast<unsigned>(worker));
+      }
+      return nodes;
+    }
+    size_t worker = 0;
+    for (size_t node = 0; node < m_nodeWorkers.size(); node++) {
+      nodes.push_back({m_nodeIds[node], {}});
+      for (size_t i = 0; i < m_nodeWorkers[node]; i++) {
+        nodes.back().cpus.push_back(m_cpus[worker++]);
+      }
+    }
+    return nodes;
+  }
+
+  // Called by each worker thread as it starts.
+  void pin(size_t worker) const {
+    if (is_pinned()) {
+      pin_current_thread(m_cpus[worker]);
+    }
+  }
+
+private:
+  std::vector<unsigned> m_cpus;
+  std::vector<size_t> m_nodes;
+  std::vector<size_t> m_nodeWorkers;
+  std::vector<unsigned> m_nodeIds;
+};
+
+// Parses a sysfs or /proc/meminfo size, such as "48K", "2048K", "1M" or
+// "16384 kB", into bytes. Returns 0 if malformed.
+inline uint64_t parse_size(const std::string &text) {
+  const char *p = text.c_str();
+  char *end = nullptr;
+  const unsigned long long value = std::strtoull(p, &end, 10);
+  if (end == p) {
+    return 0;
+  }
+  while (*end == ' ') {
+    end++;
+  }
+  switch (*end) {
+  case 'k':
+  case 'K':
+    return value << 10;
+  case 'M':
+    return value << 20;
+  case 'G':
+    return value << 30;
+  default:
+    return value;
+  }
+}
+
+// Reads the field `key` of `meminfoPath`, which has the layout of
+// /proc/meminfo, in bytes. Returns 0 if it can't be read.
+inline uint64_t read_meminfo(const std::string &meminfoPath,
+                             const std::string &key) {
+  std::ifstream meminfo(meminfoPath);
+  std::string line;
+  while (std::getline(meminfo, line)) {
+    if (line.compare(0, key.size(), key) == 0 && line.size() > key.size() &&
+        line[key.size()] == ':') {
+      return parse_size(line.substr(key.size() + 1));
+    }
+  }
+  return 0;
+}
+
+// One level of the data cache hierarchy of a CPU.
+struct cache_level_t {
+  unsigned level;
+  uint64_t size;
+  uint32_t lineSize;
+};
+
+// Reads the data and unified caches from `cacheDir`, which has the layout of
+// /sys/devices/system/cpu/cpu0/cache, in ascending order of level.
+inline std::vector<cache_level_t> read_caches(const std::string &cacheDir) {
+  std::vector<cache_level_t> caches;
+  for (unsigned index = 0;; index++) {
+    const std::string dir = cacheDir + "/index" + std::to_string(index);
+    std::ifstream levelFile(dir + "/level");
+    std::string level, type, size, lineSize;
+    if (!std::getline(levelFile, level)) {
+      break;
+    }
+    std::ifstream(dir + "/type") >> type;
+    if (type == "Instruction") {
+      continue;
+    }
+    std::getline(std::ifstream(dir + "/size"), size);
+    std::getline(std::ifstream(dir + "/coherency_line_size"), lineSize);
+    caches.push_back({static_cast<unsigned>(std::strtoul(level.c_str(),
+                                                         nullptr, 10)),
+                      parse_size(size),
+                      static_cast<uint32_t>(parse_size(lineSize))});
+  }
+  std::sort(caches.begin(), caches.end(),
+            [](const cache_level_t &a, const cache_level_t &b) {
+              return a.level < b.level;
+            });
+  return caches;
+}
+
+// What the host offers to kernels. Probing reads a handful of files, so it is
+// done once per device rather than on every info query.
+struct host_info_t {
+  // Physical memory in bytes
+  uint64_t memSize = 0;
+  // Data caches of the first CPU, from L1 outwards
+  std::vector<cache_level_t> caches;
+  // Width in bytes of the widest vector registers: 16, 32 with AVX2 and 64
+  // with AVX-512
+  uint32_t simdWidth = 16;
+
+  // Size of cache `level`, or 0 if there is none.
+  uint64_t cache_size(unsigned level) const noexcept {
+    for (const auto &cache : caches) {
+      if (cache.level == level) {
+        return cache.size;
+      }
+    }
+    return 0;
+  }
+
+  // Size of the outermost cache, or 0 if unknown.
+  uint64_t last_level_cache_size() const noexcept {
+    return caches.empty() ? 0 : caches.back().size;
+  }
+
+  uint32_t cache_line_size() const noexcept {
+    return caches.empty() || caches[0].lineSize == 0 ? 64
+                                                     : caches[0].lineSize;
+  }
+
+  static host_info_t probe() {
+    host_info_t info;
+    info.memSize = read_meminfo("/proc/meminfo", "MemTotal");
+#ifdef __linux__
+    if (info.memSize == 0) {
+      info.memSize = static_cast<uint64_t>(sysconf(_SC_PHYS_PAGES)) *
+                     static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    info.caches = read_caches("/sys/devices/system/cpu/cpu0/cache");
+#if defined(__x86_64__) || defined(__i386__)
+    if (__builtin_cpu_supports("avx512f")) {
+      info.simdWidth = 64;
+    } else if (__builtin_cpu_supports("avx2")) {
+      info.simdWidth = 32;
+    }
+#endif
+    return info;
+  }
+};
+
+} // namespace native_cpu
@@ -8,69 +8,255 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
 #include "ur_api.h"
 
+#include "bulk_memory.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "usm.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
-  std::ignore = hContext;
-  std::ignore = pUSMDesc;
-  std::ignore = pool;
+namespace native_cpu {
+void *allocateHostMemory(size_t size, size_t alignment) {
+  alignment = std::max(alignment, alignof(std::max_align_t));
+#ifdef _WIN32
+  return _aligned_malloc(size, alignment);
+#else
+  void *ptr = nullptr;
+  return posix_memalign(&ptr, alignment, size) == 0 ? ptr : nullptr;
+#endif
+}
 
-  UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
-  UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
+void freeHostMemory(void *ptr) {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  ::free(ptr);
+#endif
+}
+
+static ur_result_t &getLastStatusRef() {
+  static thread_local ur_result_t LastStatus = UR_RESULT_SUCCESS;
+  return LastStatus;
+}
+
+umf_result_t usm_memory_provider_t::alloc(size_t size, size_t alignment,
+                                          void **ptr) {
+  *ptr = allocateHostMemory(size, alignment);
+  if (*ptr == nullptr) {
+    getLastStatusRef() = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+  bulk::firstTouch(hDevice->tp, *ptr, size);
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t usm_memory_provider_t::free(void *ptr, size_t) {
+  freeHostMemory(ptr);
+  return UMF_RESULT_SUCCESS;
+}
+
+void usm_memory_provider_t::get_last_native_error(const char **,
+                                                  int32_t *pError) {
+  *pError = static_cast<int32_t>(getLastStatusRef());
+}
+
+umf_result_t
+usm_memory_provider_t::get_recommended_page_size(size_t, size_t *pageSize) {
+  *pageSize = alignof(std::max_align_t);
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t usm_memory_provider_t::get_min_page_size(void *,
+                                                      size_t *pageSize) {
+  *pageSize = alignof(std::max_align_t);
+  return UMF_RESULT_SUCCESS;
+}
+
+usm::DisjointPoolAllConfigs initializeDisjointPoolConfig() {
+  const char *TraceVal = std::getenv("UR_NATIVE_CPU_USM_ALLOCATOR_TRACE");
+  const int Trace = TraceVal ? std::atoi(TraceVal) : 0;
+  if (const char *ConfigVal = std::getenv("UR_NATIVE_CPU_USM_ALLOCATOR")) {
+    return usm::parseDisjointPoolConfig(ConfigVal, Trace);
+  }
 
-  *ppMem = malloc(size);
+  // Shared allocations are host memory like all others, so there is no
+  // migration cost that would make pooling them undesirable: use the host
+  // settings for them.
+  usm::DisjointPoolAllConfigs Configs(Trace);
+  for (auto MemType : {usm::DisjointPoolMemType::Shared,
+                       usm::DisjointPoolMemType::SharedReadOnly}) {
+    auto &Config = Configs.Configs[MemType];
+    const char *Name = Config.Name;
+    Config = Configs.Configs[usm::DisjointPoolMemType::Host];
+    Config.Name = Name;
+  }
+  return Configs;
+}
+} // namespace native_cpu
 
+ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(
+    ur_context_handle_t hContext, const ur_usm_pool_desc_t *pPoolDesc)
+    : hContext(hContext),
+      disjointPoolConfigs(native_cpu::initializeDisjointPoolConfig()) {
+  if (!pPoolDesc) {
+    return;
+  }
+  zeroInitialize = pPoolDesc->flags & UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK;
+  if (auto *Limits = find_stype_node<ur_usm_pool_limits_desc_t>(pPoolDesc)) {
+    for (auto &Config : disjointPoolConfigs.Configs) {
+      Config.MaxPoolableSize = Limits->maxPoolableSize;
+      Config.SlabMinSize = Limits->minDriverAllocSize;
+    }
+  }
+}
+
+ur_result_t ur_usm_pool_handle_t_::init() {
+  auto [Err, Descriptors] = usm::pool_descriptor::create(this, hContext);
+  if (Err != UR_RESULT_SUCCESS) {
+    return Err;
+  }
+
+  for (auto &Desc : Descriptors) {
+    auto MemType = usm::DisjointPoolMemType::Host;
+    if (Desc.type == UR_USM_TYPE_DEVICE) {
+      MemType = usm::DisjointPoolMemType::Device;
+    } else if (Desc.type == UR_USM_TYPE_SHARED) {
+      MemType = Desc.deviceReadOnly ? usm::DisjointPoolMemType::SharedReadOnly
+                                    : usm::DisjointPoolMemType::Shared;
+    }
+
+    auto [ProviderErr, Provider] =
+        umf::memoryProviderMakeUnique<native_cpu::usm_memory_provider_t>(
+            Desc.hDevice ? Desc.hDevice : hContext->_device);
+    if (ProviderErr != UMF_RESULT_SUCCESS) {
+      return umf::umf2urResult(ProviderErr);
+    }
+    auto [PoolErr, Pool] = umf::poolMakeUniqueFromOps(
+        &UMF_DISJOINT_POOL_OPS, std::move(Provider),
+        &disjointPoolConfigs.Configs[MemType]);
+    if (PoolErr != UMF_RESULT_SUCCESS) {
+      return umf::umf2urResult(PoolErr);
+    }
+
+    umfPools.push_back(Pool.get());
+    if (auto AddErr = poolManager.addPool(Desc, Pool)) {
+      return AddErr;
+    }
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
-                 size_t size, void **ppMem) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pUSMDesc;
-  std::ignore = pool;
+ur_result_t ur_usm_pool_handle_t_::allocate(ur_device_handle_t hDevice,
+                                            const ur_usm_desc_t *pUSMDesc,
+                                            ur_usm_type_t type, size_t size,
+                                            void **ppMem) {
+  usm::pool_descriptor Desc{};
+  Desc.poolHandle = this;
+  Desc.hContext = hContext;
+  Desc.hDevice = hDevice;
+  Desc.type = type;
+  if (auto *DeviceDesc = find_stype_node<ur_usm_device_desc_t>(pUSMDesc)) {
+    Desc.deviceReadOnly =
+        DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY;
+  }
+
+  auto hUMFPool = poolManager.getPool(Desc);
+  // Pools are only created for the devices of the context, sub-devices share
+  // the pools of their root device.
+  while (!hUMFPool && Desc.hDevice && Desc.hDevice->ParentDevice) {
+    Desc.hDevice = Desc.hDevice->ParentDevice;
+    hUMFPool = poolManager.getPool(Desc);
+  }
+  if (!hUMFPool) {
+    return UR_RESULT_ERROR_INVALID_DEVICE;
+  }
+
+  const size_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
+  *ppMem = umfPoolAlignedMalloc(*hUMFPool, size, Alignment);
+  if (*ppMem == nullptr) {
+    return umf::umf2urResult(umfPoolGetLastAllocationError(*hUMFPool));
+  }
+  if (zeroInitialize) {
+    memset(*ppMem, 0, size);
+  }
+  return UR_RESULT_SUCCESS;
+}
 
+bool ur_usm_pool_handle_t_::hasUMFPool(
+    umf_memory_pool_handle_t hUMFPool) const {
+  return std::find(umfPools.begin(), umfPools.end(), hUMFPool) !=
+         umfPools.end();
+}
+
+static ur_result_t allocateUSM(ur_context_handle_t hContext,
+                               ur_device_handle_t hDevice,
+                               const ur_usm_desc_t *pUSMDesc,
+                               ur_usm_pool_handle_t hPool, ur_usm_type_t type,
+                               size_t size, void **ppMem) {
   UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
   UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
+  const uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
+  UR_ASSERT((Alignment & (Alignment - 1)) == 0, UR_RESULT_ERROR_INVALID_VALUE);
 
-  *ppMem = malloc(size);
-
+#ifdef UMF_ENABLE_POOL_TRACKING
+  if (!hPool) {
+    hPool = hContext->_defaultPool;
+  }
+  if (auto Err = hPool->allocate(hDevice, pUSMDesc, type, size, ppMem)) {
+    return Err;
+  }
+#else
+  // Without pool tracking pooled allocations can't be freed, so allocate
+  // directly.
+  std::ignore = hPool;
+  *ppMem = native_cpu::allocateHostMemory(size, Alignment);
+  if (*ppMem == nullptr) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  native_cpu::bulk::firstTouch(hContext->_device->tp, *ppMem, size);
+#endif
+  hContext->_usmAllocs.insert({*ppMem, size, type, hDevice});
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
+               ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
+  return allocateUSM(hContext, nullptr, pUSMDesc, pool, UR_USM_TYPE_HOST, size,
+                     ppMem);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pUSMDesc;
-  std::ignore = pool;
-
-  UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
-  UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
-
-  *ppMem = malloc(size);
+  return allocateUSM(hContext, hDevice, pUSMDesc, pool, UR_USM_TYPE_DEVICE,
+                     size, ppMem);
+}
 
-  return UR_RESULT_SUCCESS;
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
+                 size_t size, void **ppMem) {
+  return allocateUSM(hContext, hDevice, pUSMDesc, pool, UR_USM_TYPE_SHARED,
+                     size, ppMem);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
                                               void *pMem) {
-  std::ignore = hContext;
-
   UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  free(pMem);
+  hContext->_usmAllocs.erase(pMem);
+  if (auto hUMFPool = umfPoolByPtr(pMem)) {
+    return umf::umf2urResult(umfPoolFree(hUMFPool, pMem));
+  }
+  native_cpu::freeHostMemory(pMem);
 
   return UR_RESULT_SUCCESS;
 }
@@ -79,59 +265,97 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
                      ur_usm_alloc_info_t propName, size_t propSize,
                      void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hContext;
-  std::ignore = pMem;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
-
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
+  const auto Alloc = hContext->_usmAllocs.find(pMem);
+
   switch (propName) {
   case UR_USM_ALLOC_INFO_TYPE:
-    // Todo implement this in context
-    return ReturnValue(UR_USM_TYPE_DEVICE);
+    return ReturnValue(Alloc ? Alloc->type : UR_USM_TYPE_UNKNOWN);
+  case UR_USM_ALLOC_INFO_BASE_PTR:
+    if (!Alloc) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    return ReturnValue(Alloc->base);
+  case UR_USM_ALLOC_INFO_SIZE:
+    if (!Alloc) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    return ReturnValue(Alloc->size);
+  case UR_USM_ALLOC_INFO_DEVICE:
+    if (!Alloc) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    return ReturnValue(Alloc->device);
+  case UR_USM_ALLOC_INFO_POOL: {
+    auto hUMFPool = umfPoolByPtr(pMem);
+    if (!hUMFPool) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    ur_usm_pool_handle_t hPool = hContext->getOwningURPool(hUMFPool);
+    if (!hPool) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    return ReturnValue(hPool);
+  }
   default:
-    DIE_NO_IMPLEMENTATION;
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
-  return UR_RESULT_ERROR_INVALID_VALUE;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolCreate(ur_context_handle_t hContext, ur_usm_pool_desc_t *pPoolDesc,
                 ur_usm_pool_handle_t *ppPool) {
+  // Without pool tracking we can't free pool allocations.
+#ifdef UMF_ENABLE_POOL_TRACKING
+  auto *Pool = new ur_usm_pool_handle_t_(hContext, pPoolDesc);
+  if (auto Err = Pool->init()) {
+    delete Pool;
+    return Err;
+  }
+  hContext->incrementReferenceCount();
+  hContext->addPool(Pool);
+  *ppPool = Pool;
+  return UR_RESULT_SUCCESS;
+#else
   std::ignore = hContext;
   std::ignore = pPoolDesc;
   std::ignore = ppPool;
-
-  DIE_NO_IMPLEMENTATION;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolRetain(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+  pPool->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolRelease(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+  if (pPool->decrementReferenceCount() > 0) {
+    return UR_RESULT_SUCCESS;
+  }
+  ur_context_handle_t hContext = pPool->hContext;
+  hContext->removePool(pPool);
+  delete pPool;
+  decrementOrDelete(hContext);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMPoolGetInfo(ur_usm_pool_handle_t hPool, ur_usm_pool_info_t propName,
                  size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hPool;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_USM_POOL_INFO_REFERENCE_COUNT:
+    return ReturnValue(hPool->getReferenceCount());
+  case UR_USM_POOL_INFO_CONTEXT:
+    return ReturnValue(hPool->hContext);
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMImportExp(ur_context_handle_t Context,
@@ -0,0 +1,131 @@
+//===------------- usm.hpp - NATIVE CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "ur/ur.hpp"
+#include "ur_api.h"
+
+#include "common.hpp"
+
+#include <umf/memory_pool.h>
+#include <umf_helpers.hpp>
+#include <umf_pools/disjoint_pool_config_parser.hpp>
+#include <ur_pool_manager.hpp>
+
+namespace native_cpu {
+// Allocates `size` bytes of host memory aligned to `alignment`, which must be
+// zero or a power of two. Returns nullptr on failure.
+void *allocateHostMemory(size_t size, size_t alignment);
+void freeHostMemory(void *ptr);
+
+// UMF memory provider backing the USM pools. Every USM allocation type is
+// plain host memory on this device, so a single provider serves them all.
+// Large allocations are first-touched from the workers of the device.
+class usm_memory_provider_t {
+public:
+  umf_result_t initialize(ur_device_handle_t Device) {
+    hDevice = Device;
+    return UMF_RESULT_SUCCESS;
+  }
+  umf_result_t alloc(size_t size, size_t alignment, void **ptr);
+  umf_result_t free(void *ptr, size_t size);
+  void get_last_native_error(const char **ppMessage, int32_t *pError);
+  umf_result_t get_recommended_page_size(size_t size, size_t *pageSize);
+  umf_result_t get_min_page_size(void *ptr, size_t *pageSize);
+  umf_result_t purge_lazy(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_force(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  const char *get_name() { return "NativeCPUUSMMemoryProvider"; }
+
+private:
+  ur_device_handle_t hDevice = nullptr;
+};
+
+// Live USM allocations of a context, keyed by base address so that the
+// allocation containing any pointer is found in O(log n). Queries vastly
+// outnumber allocations, so lookups only take the lock shared.
+class usm_alloc_map_t {
+public:
+  struct alloc_info_t {
+    void *base;
+    size_t size;
+    ur_usm_type_t type;
+    // nullptr for host allocations
+    ur_device_handle_t device;
+  };
+
+  void insert(const alloc_info_t &info) {
+    std::lock_guard<ur_shared_mutex> Lock(mutex);
+    allocs[reinterpret_cast<uintptr_t>(info.base)] = info;
+  }
+
+  void erase(void *base) {
+    std::lock_guard<ur_shared_mutex> Lock(mutex);
+    allocs.erase(reinterpret_cast<uintptr_t>(base));
+  }
+
+  // Returns the allocation containing `ptr`, if any.
+  std::optional<alloc_info_t> find(const void *ptr) const {
+    const auto addr = reinterpret_cast<uintptr_t>(ptr);
+    std::shared_lock<ur_shared_mutex> Lock(mutex);
+    auto It = allocs.upper_bound(addr);
+    if (It == allocs.begin()) {
+      return std::nullopt;
+    }
+    --It;
+    if (addr - It->first >= It->second.size) {
+      return std::nullopt;
+    }
+    return It->second;
+  }
+
+private:
+  mutable ur_shared_mutex mutex;
+  std::map<uintptr_t, alloc_info_t> allocs;
+};
+
+// Reads the disjoint pool configuration from UR_NATIVE_CPU_USM_ALLOCATOR,
+// which uses the syntax of usm::parseDisjointPoolConfig.
+usm::DisjointPoolAllConfigs initializeDisjointPoolConfig();
+} // namespace native_cpu
+
+struct ur_usm_pool_handle_t_ : RefCounted {
+  ur_usm_pool_handle_t_(ur_context_handle_t hContext,
+                        const ur_usm_pool_desc_t *pPoolDesc);
+
+  // Creates a UMF pool for each USM type and device of the context.
+  ur_result_t init();
+
+  ur_result_t allocate(ur_device_handle_t hDevice,
+                       const ur_usm_desc_t *pUSMDesc, ur_usm_type_t type,
+                       size_t size, void **ppMem);
+
+  bool hasUMFPool(umf_memory_pool_handle_t hUMFPool) const;
+
+  ur_context_handle_t const hContext;
+
+private:
+  usm::DisjointPoolAllConfigs disjointPoolConfigs;
+  usm::pool_manager<usm::pool_descriptor> poolManager;
+  std::vector<umf_memory_pool_handle_t> umfPools;
+  bool zeroInitialize = false;
+};
@@ -8,10 +8,156 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "virtual_mem.hpp"
 #include "common.hpp"
 #include "context.hpp"
 #include "physical_mem.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+
+size_t native_cpu::virtualMemGranularity() {
+  static const size_t PageSize = sysconf(_SC_PAGESIZE);
+  return PageSize;
+}
+
+static int accessToProt(ur_virtual_mem_access_flags_t flags) {
+  if (flags & UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE) {
+    return PROT_READ | PROT_WRITE;
+  }
+  if (flags & UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY) {
+    return PROT_READ;
+  }
+  return PROT_NONE;
+}
+
+// Reserved address space that isn't mapped onto physical memory is an
+// inaccessible anonymous mapping, which doesn't count towards the commit
+// charge.
+static constexpr int ReservedFlags =
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    ur_virtual_mem_granularity_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  std::ignore = hDevice;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_VIRTUAL_MEM_GRANULARITY_INFO_MINIMUM:
+  case UR_VIRTUAL_MEM_GRANULARITY_INFO_RECOMMENDED:
+    return ReturnValue(native_cpu::virtualMemGranularity());
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemReserve(
+    ur_context_handle_t hContext, const void *pStart, size_t size,
+    void **ppStart) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(ppStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // pStart is only a hint
+  void *Ptr = mmap(const_cast<void *>(pStart), size, PROT_NONE, ReservedFlags,
+                   -1, 0);
+  if (Ptr == MAP_FAILED) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  *ppStart = Ptr;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemFree(
+    ur_context_handle_t hContext, const void *pStart, size_t size) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  if (munmap(const_cast<void *>(pStart), size) != 0) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->_virtualMemAccess.erase(pStart, size);
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urVirtualMemSetAccess(ur_context_handle_t hContext, const void *pStart,
+                      size_t size, ur_virtual_mem_access_flags_t flags) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(!(flags & UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK),
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
+
+  if (mprotect(const_cast<void *>(pStart), size, accessToProt(flags)) != 0) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->_virtualMemAccess.set(pStart, size, flags);
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urVirtualMemMap(ur_context_handle_t hContext, const void *pStart, size_t size,
+                ur_physical_mem_handle_t hPhysicalMem, size_t offset,
+                ur_virtual_mem_access_flags_t flags) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(!(flags & UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK),
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
+  UR_ASSERT(offset <= hPhysicalMem->Size &&
+                size <= hPhysicalMem->Size - offset,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  // Replaces the reservation, so no other mapping can slip in between
+  void *Ptr = mmap(const_cast<void *>(pStart), size, accessToProt(flags),
+                   MAP_SHARED | MAP_FIXED, hPhysicalMem->Fd,
+                   static_cast<off_t>(offset));
+  if (Ptr == MAP_FAILED) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->_virtualMemAccess.set(pStart, size, flags);
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(
+    ur_context_handle_t hContext, const void *pStart, size_t size) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // The range goes back to being reserved rather than being released
+  void *Ptr = mmap(const_cast<void *>(pStart), size, PROT_NONE,
+                   ReservedFlags | MAP_FIXED, -1, 0);
+  if (Ptr == MAP_FAILED) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->_virtualMemAccess.erase(pStart, size);
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(
+    ur_context_handle_t hContext, const void *pStart, size_t size,
+    ur_virtual_mem_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  std::ignore = size;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_VIRTUAL_MEM_INFO_ACCESS_MODE:
+    return ReturnValue(hContext->_virtualMemAccess.find(pStart));
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+}
+#else
+// Virtual memory is built on mmap and memfd_create, which only Linux
+// provides together.
+size_t native_cpu::virtualMemGranularity() { return 0; }
+
 UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     ur_context_handle_t, ur_device_handle_t, ur_virtual_mem_granularity_info_t,
     size_t, void *, size_t *) {
@@ -52,3 +198,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(ur_context_handle_t,
                                                         size_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+#endif
@@ -0,0 +1,86 @@
+//===--------- virtual_mem.hpp - NATIVE CPU Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include <ur_api.h>
+
+namespace native_cpu {
+// Granularity of virtual memory reservations, mappings and physical memory,
+// which is the page size.
+size_t virtualMemGranularity();
+
+// Access flags of the mapped virtual memory of a context, kept as disjoint
+// ranges keyed by their start address. The protection of the pages can't be
+// read back from the OS cheaply, so urVirtualMemGetInfo answers from here.
+class virtual_mem_access_map_t {
+public:
+  // Sets the access of [ptr, ptr + size), splitting the ranges it overlaps.
+  void set(const void *ptr, size_t size, ur_virtual_mem_access_flags_t flags) {
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> Lock(mutex);
+    eraseLocked(begin, begin + size);
+    ranges[begin] = {begin + size, flags};
+  }
+
+  // Forgets the access of [ptr, ptr + size), e.g. once it has been unmapped.
+  void erase(const void *ptr, size_t size) {
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> Lock(mutex);
+    eraseLocked(begin, begin + size);
+  }
+
+  // Returns the access of the page at `ptr`, UR_VIRTUAL_MEM_ACCESS_FLAG_NONE
+  // if nothing is mapped there.
+  ur_virtual_mem_access_flags_t find(const void *ptr) const {
+    const auto addr = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> Lock(mutex);
+    auto It = ranges.upper_bound(addr);
+    if (It == ranges.begin() || addr >= std::prev(It)->second.end) {
+      return UR_VIRTUAL_MEM_ACCESS_FLAG_NONE;
+    }
+    return std::prev(It)->second.flags;
+  }
+
+private:
+  struct range_t {
+    uintptr_t end;
+    ur_virtual_mem_access_flags_t flags;
+  };
+
+  void eraseLocked(uintptr_t begin, uintptr_t end) {
+    auto It = ranges.lower_bound(begin);
+    if (It != ranges.begin()) {
+      // Keep the parts of a range starting before `begin` that lie outside
+      auto Prev = std::prev(It);
+      if (Prev->second.end > begin) {
+        if (Prev->second.end > end) {
+          ranges[end] = {Prev->second.end, Prev->second.flags};
+        }
+        Prev->second.end = begin;
+      }
+    }
+    while (It != ranges.end() && It->first < end) {
+      if (It->second.end > end) {
+        ranges[end] = {It->second.end, It->second.flags};
+      }
+      It = ranges.erase(It);
+    }
+  }
+
+  mutable std::mutex mutex;
+  std::map<uintptr_t, range_t> ranges;
+};
+} // namespace native_cpu
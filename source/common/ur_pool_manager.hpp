@@ -119,7 +119,7 @@ urGetAllDevicesAndSubDevices(ur_context_handle_t hContext) {
         if (ret != UR_RESULT_SUCCESS) {
             if (ret == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
                 // Return main devices when sub-devices are unsupported.
-                return {ret, std::move(devices)};
+                return {UR_RESULT_SUCCESS, std::move(devices)};
             }
 
             return {ret, {}};
@@ -11,23 +11,129 @@
 #ifndef UR_SINGLETON_H
 #define UR_SINGLETON_H 1
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// singletons are reference counted, so that the instance for a key is
+/// released along with the last reference handed out for it, and are
+/// allocated from slabs owned by the factory, so that memory freed by
+/// released singletons is reused by the next ones created
+///
+/// singletons whose handles aren't reference counted, such as root devices,
+/// are pinned instead, and kept until the factory is destroyed
+///
+/// keys are spread over shards, each with its own lock, map and slabs, so
+/// that threads creating and releasing handles concurrently don't serialize
+/// on a single lock
 template <typename singleton_tn, typename key_tn> class singleton_factory_t {
   protected:
     using singleton_t = singleton_tn;
     using key_t = typename std::conditional<std::is_pointer<key_tn>::value,
                                             size_t, key_tn>::type;
 
-    using ptr_t = std::unique_ptr<singleton_t>;
-    using map_t = std::unordered_map<key_t, ptr_t>;
+    //////////////////////////////////////////////////////////////////////////
+    /// a singleton along with the number of references handed out to it
+    struct entry_t {
+        template <typename... Ts>
+        entry_t(Ts &&...params) : instance(std::forward<Ts>(params)...) {}
+
+        singleton_t instance;
+        size_t refCount = 0;
+        bool pinned = false; ///< owned by the factory, ignores references
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// storage for an entry, which links the free list while unused
+    union slot_t {
+        slot_t *next;
+        alignas(entry_t) unsigned char storage[sizeof(entry_t)];
+    };
+
+    static constexpr size_t slabSize = 64; ///< slots allocated at a time
+    static constexpr size_t shardBits = 6; ///< log2 of the number of shards
+
+    using map_t = std::unordered_map<key_t, entry_t *>;
+    using slab_t = std::unique_ptr<slot_t[]>;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the singletons for a subset of the keys, each subset locked separately
+    /// so that threads working with different keys rarely contend
+    struct alignas(64) shard_t {
+        std::mutex mut;              ///< lock for thread-safety
+        map_t map;                   ///< single instance of singleton per key
+        std::vector<slab_t> slabs;   ///< storage of all entries, live or not
+        slot_t *freeSlots = nullptr; ///< slots not holding an entry
+
+        ~shard_t() {
+            for (auto &iter : map) {
+                iter.second->~entry_t();
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        /// constructs an entry in a free slot, adding a slab if there is none
+        template <typename... Ts> entry_t *allocate(Ts &&...params) {
+            if (nullptr == freeSlots) {
+                auto slab = std::make_unique<slot_t[]>(slabSize);
+                for (size_t i = 0; i + 1 < slabSize; ++i) {
+                    slab[i].next = &slab[i + 1];
+                }
+                slab[slabSize - 1].next = nullptr;
+                slabs.push_back(std::move(slab));
+                freeSlots = slabs.back().get();
+            }
+
+            slot_t *slot = freeSlots;
+            freeSlots = slot->next;
+            try {
+                return new (slot->storage)
+                    entry_t(std::forward<Ts>(params)...);
+            } catch (...) {
+                slot->next = freeSlots;
+                freeSlots = slot;
+                throw;
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        /// destroys an entry and returns its slot to the free list
+        void deallocate(entry_t *entry) {
+            entry->~entry_t();
+            auto slot = reinterpret_cast<slot_t *>(entry);
+            slot->next = freeSlots;
+            freeSlots = slot;
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        /// gets the entry for the key, creating it if none exists
+        template <typename... Ts>
+        entry_t *getEntry(key_t key, Ts &&...params) {
+            auto iter = map.find(key);
+            if (map.end() != iter) {
+                return iter->second;
+            }
+
+            entry_t *entry = allocate(std::forward<Ts>(params)...);
+            try {
+                map.emplace(key, entry);
+            } catch (...) {
+                deallocate(entry);
+                throw;
+            }
+            return entry;
+        }
+    };
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    shard_t shards[size_t{1} << shardBits];
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -36,6 +142,14 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
         return reinterpret_cast<key_t>(key);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// picks the shard of a key, mixing the bits of the hash first as handles
+    /// are usually aligned pointers
+    shard_t &getShard(key_t key) {
+        uint64_t hash = static_cast<uint64_t>(std::hash<key_t>{}(key));
+        return shards[(hash * 0x9E3779B97F4A7C15ull) >> (64 - shardBits)];
+    }
+
   public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -47,6 +161,7 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
     /// if no instance exists, then creates a new instance
     /// the params are forwarded to the ctor of the singleton
     /// the first parameter must be the unique identifier of the instance
+    /// the caller is handed a reference to the instance, dropped by release
     template <typename... Ts> singleton_tn *getInstance(Ts &&...params) {
         auto key = getKey(params...);
 
@@ -54,22 +169,86 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
             return static_cast<singleton_tn *>(0);
         }
 
-        std::lock_guard<std::mutex> lk(mut);
-        auto iter = map.find(key);
+        shard_t &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        entry_t *entry = shard.getEntry(key, std::forward<Ts>(params)...);
+        ++entry->refCount;
+        return &entry->instance;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// gets a pointer to a unique instance of singleton, as getInstance
+    /// does, and pins it, for a key whose lifetime isn't reference counted
+    template <typename... Ts> singleton_tn *getPinnedInstance(Ts &&...params) {
+        auto key = getKey(params...);
+
+        if (key == 0) { // No zero keys allowed in map
+            return static_cast<singleton_tn *>(0);
+        }
+
+        shard_t &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        entry_t *entry = shard.getEntry(key, std::forward<Ts>(params)...);
+        entry->pinned = true;
+        return &entry->instance;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// gets a pointer to the instance of a key handed out without a
+    /// reference, such as by a query; as nothing would release an instance
+    /// created for such a key, it is pinned
+    template <typename... Ts>
+    singleton_tn *getBorrowedInstance(Ts &&...params) {
+        auto key = getKey(params...);
+
+        if (key == 0) { // No zero keys allowed in map
+            return static_cast<singleton_tn *>(0);
+        }
+
+        shard_t &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(key);
+        if (shard.map.end() != iter) {
+            return &iter->second->instance;
+        }
+
+        entry_t *entry = shard.getEntry(key, std::forward<Ts>(params)...);
+        entry->pinned = true;
+        return &entry->instance;
+    }
 
-        if (map.end() == iter) {
-            auto ptr =
-                std::make_unique<singleton_t>(std::forward<Ts>(params)...);
-            iter = map.emplace(key, std::move(ptr)).first;
+    //////////////////////////////////////////////////////////////////////////
+    /// adds a reference to the instance of the key, if there is one
+    void retain(key_tn key) {
+        shard_t &shard = getShard(getKey(key));
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(getKey(key));
+        if (shard.map.end() != iter && !iter->second->pinned) {
+            ++iter->second->refCount;
         }
-        return iter->second.get();
     }
 
     //////////////////////////////////////////////////////////////////////////
-    /// once the key is no longer valid, release the singleton
+    /// drops a reference to the instance of the key, and once the key is no
+    /// longer valid, release the singleton
     void release(key_tn key) {
-        std::lock_guard<std::mutex> lk(mut);
-        map.erase(getKey(key));
+        shard_t &shard = getShard(getKey(key));
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(getKey(key));
+        if (shard.map.end() == iter) {
+            return;
+        }
+
+        entry_t *entry = iter->second;
+        if (entry->pinned) {
+            return;
+        }
+        if (entry->refCount > 1) {
+            --entry->refCount;
+            return;
+        }
+        shard.map.erase(iter);
+        shard.deallocate(entry);
     }
 };
 
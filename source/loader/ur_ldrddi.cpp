@@ -9,6 +9,7 @@
  * @file ur_ldrddi.cpp
  *
  */
+#include "ur_lib.hpp"
 #include "ur_lib_loader.hpp"
 #include "ur_loader.hpp"
 
@@ -50,6 +51,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
+    // adapters are loaded here rather than by urLoaderInit when lazy
+    context->loadLazyAdapters();
+
     size_t adapterIndex = 0;
     if (nullptr != phAdapters && NumEntries != 0) {
         for (auto &platform : context->platforms) {
@@ -101,6 +105,13 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
     // forward to device-platform
     result = pfnAdapterRelease(hAdapter);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_adapter_factory.release(hAdapter);
+
     return result;
 }
 
@@ -124,6 +135,13 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
     // forward to device-platform
     result = pfnAdapterRetain(hAdapter);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_adapter_factory.retain(hAdapter);
+
     return result;
 }
 
@@ -472,7 +490,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         // convert platform handles to loader handles
         for (size_t i = 0; (nullptr != phDevices) && (i < NumEntries); ++i) {
             phDevices[i] = reinterpret_cast<ur_device_handle_t>(
-                ur_device_factory.getInstance(phDevices[i], dditable));
+                ur_device_factory.getPinnedInstance(phDevices[i], dditable));
         }
     } catch (std::bad_alloc &) {
         result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -532,8 +550,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_platform_handle_t>(
-                            ur_platform_factory.getInstance(handles[i],
-                                                            dditable));
+                            ur_platform_factory.getBorrowedInstance(handles[i],
+                                                                    dditable));
                     }
                 }
             } break;
@@ -544,8 +562,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -556,8 +574,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -568,8 +586,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -605,6 +623,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
     // forward to device-platform
     result = pfnRetain(hDevice);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_device_factory.retain(hDevice);
+
     return result;
 }
 
@@ -628,6 +653,13 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
     // forward to device-platform
     result = pfnRelease(hDevice);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_device_factory.release(hDevice);
+
     return result;
 }
 
@@ -835,7 +867,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     }
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(DeviceCount);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(DeviceCount);
     for (size_t i = 0; i < DeviceCount; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -881,6 +913,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     // forward to device-platform
     result = pfnRetain(hContext);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_context_factory.retain(hContext);
+
     return result;
 }
 
@@ -904,6 +943,13 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     // forward to device-platform
     result = pfnRelease(hContext);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_context_factory.release(hContext);
+
     return result;
 }
 
@@ -959,8 +1005,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -1029,7 +1075,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     }
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -1185,6 +1231,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
     // forward to device-platform
     result = pfnRetain(hMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_mem_factory.retain(hMem);
+
     return result;
 }
 
@@ -1208,6 +1261,13 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
     // forward to device-platform
     result = pfnRelease(hMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_mem_factory.release(hMem);
+
     return result;
 }
 
@@ -1432,8 +1492,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -1542,6 +1602,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
     // forward to device-platform
     result = pfnRetain(hSampler);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_sampler_factory.retain(hSampler);
+
     return result;
 }
 
@@ -1566,6 +1633,13 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
     // forward to device-platform
     result = pfnRelease(hSampler);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_sampler_factory.release(hSampler);
+
     return result;
 }
 
@@ -1617,8 +1691,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -1890,8 +1964,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -1902,8 +1976,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_usm_pool_handle_t>(
-                            ur_usm_pool_factory.getInstance(handles[i],
-                                                            dditable));
+                            ur_usm_pool_factory.getBorrowedInstance(handles[i],
+                                                                    dditable));
                     }
                 }
             } break;
@@ -1977,6 +2051,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
     // forward to device-platform
     result = pfnPoolRetain(pPool);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_usm_pool_factory.retain(pPool);
+
     return result;
 }
 
@@ -2000,6 +2081,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
     // forward to device-platform
     result = pfnPoolRelease(pPool);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_usm_pool_factory.release(pPool);
+
     return result;
 }
 
@@ -2051,8 +2139,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -2364,6 +2452,13 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
     // forward to device-platform
     result = pfnRetain(hPhysicalMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_physical_mem_factory.retain(hPhysicalMem);
+
     return result;
 }
 
@@ -2390,6 +2485,13 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
     // forward to device-platform
     result = pfnRelease(hPhysicalMem);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_physical_mem_factory.release(hPhysicalMem);
+
     return result;
 }
 
@@ -2565,7 +2667,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = handle_list_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
         phProgramsLocal[i] =
             reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
@@ -2610,6 +2712,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
     // forward to device-platform
     result = pfnRetain(hProgram);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_program_factory.retain(hProgram);
+
     return result;
 }
 
@@ -2633,6 +2742,13 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
     // forward to device-platform
     result = pfnRelease(hProgram);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_program_factory.release(hProgram);
+
     return result;
 }
 
@@ -2762,8 +2878,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -2774,8 +2890,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -3077,8 +3193,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -3089,8 +3205,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_program_handle_t>(
-                            ur_program_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_program_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -3199,6 +3315,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
     // forward to device-platform
     result = pfnRetain(hKernel);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_kernel_factory.retain(hKernel);
+
     return result;
 }
 
@@ -3222,6 +3345,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
     // forward to device-platform
     result = pfnRelease(hKernel);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_kernel_factory.release(hKernel);
+
     return result;
 }
 
@@ -3542,8 +3672,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -3554,8 +3684,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_device_handle_t>(
-                            ur_device_factory.getInstance(handles[i],
-                                                          dditable));
+                            ur_device_factory.getBorrowedInstance(handles[i],
+                                                                  dditable));
                     }
                 }
             } break;
@@ -3566,7 +3696,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_queue_handle_t>(
-                            ur_queue_factory.getInstance(handles[i], dditable));
+                            ur_queue_factory.getBorrowedInstance(handles[i],
+                                                                 dditable));
                     }
                 }
             } break;
@@ -3644,6 +3775,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
     // forward to device-platform
     result = pfnRetain(hQueue);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_queue_factory.retain(hQueue);
+
     return result;
 }
 
@@ -3667,6 +3805,13 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     // forward to device-platform
     result = pfnRelease(hQueue);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_queue_factory.release(hQueue);
+
     return result;
 }
 
@@ -3840,7 +3985,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_queue_handle_t>(
-                            ur_queue_factory.getInstance(handles[i], dditable));
+                            ur_queue_factory.getBorrowedInstance(handles[i],
+                                                                 dditable));
                     }
                 }
             } break;
@@ -3851,8 +3997,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
                 for (size_t i = 0; i < nelements; ++i) {
                     if (handles[i] != nullptr) {
                         handles[i] = reinterpret_cast<ur_context_handle_t>(
-                            ur_context_factory.getInstance(handles[i],
-                                                           dditable));
+                            ur_context_factory.getBorrowedInstance(handles[i],
+                                                                   dditable));
                     }
                 }
             } break;
@@ -3919,7 +4065,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     }
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = std::vector<ur_event_handle_t>(numEvents);
+    auto phEventWaitListLocal = handle_list_t<ur_event_handle_t>(numEvents);
     for (size_t i = 0; i < numEvents; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -3951,6 +4097,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
     // forward to device-platform
     result = pfnRetain(hEvent);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_event_factory.retain(hEvent);
+
     return result;
 }
 
@@ -3974,6 +4127,13 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
     // forward to device-platform
     result = pfnRelease(hEvent);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_event_factory.release(hEvent);
+
     return result;
 }
 
@@ -4124,7 +4284,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4182,7 +4342,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4239,7 +4399,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4303,7 +4463,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4370,7 +4530,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4447,7 +4607,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4528,7 +4688,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4598,7 +4758,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4676,7 +4836,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4742,7 +4902,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4812,7 +4972,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4883,7 +5043,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4958,7 +5118,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5025,7 +5185,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5087,7 +5247,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5150,7 +5310,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5212,7 +5372,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5272,7 +5432,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5384,7 +5544,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5452,7 +5612,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5521,7 +5681,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5590,7 +5750,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5662,7 +5822,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5734,7 +5894,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6109,7 +6269,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6510,7 +6670,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6581,7 +6741,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6679,6 +6839,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
     // forward to device-platform
     result = pfnRetainExp(hCommandBuffer);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_exp_command_buffer_factory.retain(hCommandBuffer);
+
     return result;
 }
 
@@ -6707,6 +6874,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
     // forward to device-platform
     result = pfnReleaseExp(hCommandBuffer);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_exp_command_buffer_factory.release(hCommandBuffer);
+
     return result;
 }
 
@@ -7371,7 +7545,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -7424,6 +7598,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     // forward to device-platform
     result = pfnRetainCommandExp(hCommand);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // retain loader handle
+    ur_exp_command_buffer_command_factory.retain(hCommand);
+
     return result;
 }
 
@@ -7453,6 +7634,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     // forward to device-platform
     result = pfnReleaseCommandExp(hCommand);
 
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    // release loader handle
+    ur_exp_command_buffer_command_factory.release(hCommand);
+
     return result;
 }
 
@@ -7635,7 +7823,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -7734,7 +7922,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -7837,7 +8025,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -7873,7 +8061,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -7914,14 +8102,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = handle_list_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
     }
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = handle_list_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
         phProgramsLocal[i] =
             reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
@@ -8137,7 +8325,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phMemListLocal = std::vector<ur_mem_handle_t>(numMemsInMemList);
+    auto phMemListLocal = handle_list_t<ur_mem_handle_t>(numMemsInMemList);
     for (size_t i = 0; i < numMemsInMemList; ++i) {
         phMemListLocal[i] =
             reinterpret_cast<ur_mem_object_t *>(phMemList[i])->handle;
@@ -8145,7 +8333,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        handle_list_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -8171,6 +8359,174 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fills the DDI tables of an adapter loaded after urLoaderInit,
+///        which is the case when adapters are loaded lazily
+void loadDdiTables(platform_t &platform) {
+    auto handle = platform.handle.get();
+    auto &dditable = platform.dditable.ur;
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetGlobalProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetGlobalProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Global);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable =
+            reinterpret_cast<ur_pfnGetBindlessImagesExpProcAddrTable_t>(
+                LibLoader::getFunctionPtr(
+                    handle, "urGetBindlessImagesExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.BindlessImagesExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable =
+            reinterpret_cast<ur_pfnGetCommandBufferExpProcAddrTable_t>(
+                LibLoader::getFunctionPtr(
+                    handle, "urGetCommandBufferExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.CommandBufferExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetContextProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetContextProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Context);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEnqueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetEnqueueProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Enqueue);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEnqueueExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetEnqueueExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.EnqueueExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetEventProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetEventProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Event);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetKernelProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetKernelProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Kernel);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetKernelExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetKernelExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.KernelExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Mem);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetPhysicalMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetPhysicalMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.PhysicalMem);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetPlatformProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetPlatformProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.Platform);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetProgramProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetProgramProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Program);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetProgramExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetProgramExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.ProgramExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetQueueProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetQueueProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Queue);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetSamplerProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetSamplerProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Sampler);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUSMProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetUSMProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.USM);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUSMExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetUSMExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.USMExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetUsmP2PExpProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetUsmP2PExpProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.UsmP2PExp);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetVirtualMemProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetVirtualMemProcAddrTable"));
+        if (getTable) {
+            platform.initStatus =
+                getTable(context->version, &dditable.VirtualMem);
+        }
+    }
+    if (platform.initStatus == UR_RESULT_SUCCESS) {
+        auto getTable = reinterpret_cast<ur_pfnGetDeviceProcAddrTable_t>(
+            LibLoader::getFunctionPtr(handle, "urGetDeviceProcAddrTable"));
+        if (getTable) {
+            platform.initStatus = getTable(context->version, &dditable.Device);
+        }
+    }
+}
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -8199,6 +8555,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Global;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8257,6 +8621,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.BindlessImagesExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8346,6 +8718,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.CommandBufferExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8439,6 +8819,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Context;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8500,6 +8888,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Enqueue;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8583,6 +8979,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.EnqueueExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8644,6 +9048,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Event;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8705,6 +9117,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Kernel;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8776,6 +9196,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.KernelExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8831,6 +9259,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetMemProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Mem;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8894,6 +9330,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.PhysicalMem;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -8950,6 +9394,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Platform;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9011,6 +9463,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Program;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9082,6 +9542,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.ProgramExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9138,6 +9606,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Queue;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9199,6 +9675,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Sampler;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9258,6 +9742,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.USM;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9318,6 +9810,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.USMExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9373,6 +9873,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.UsmP2PExp;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9432,6 +9940,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.VirtualMem;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
@@ -9493,6 +10009,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
+    // Once the loader is initialized, return the entry points it dispatches
+    // to itself: the adapter's own when it's the only one and no layers are
+    // enabled, so that calls through the table skip the loader entirely
+    if (ur_lib::context->dispatchReady.load(std::memory_order_acquire)) {
+        *pDdiTable = ur_lib::context->urDdiTable.Device;
+        return UR_RESULT_SUCCESS;
+    }
+
     ur_result_t result = UR_RESULT_SUCCESS;
 
     // Load the device-platform DDI tables
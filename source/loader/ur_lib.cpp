@@ -27,6 +27,8 @@
 namespace ur_lib {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *context;
+ur_dditable_t dispatchDdiTable = {};
+bool directDispatch = false;
 
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t() {
@@ -100,6 +102,19 @@ __urdlllocal ur_result_t context_t::Init(
         initLayers();
     }
 
+    // Only the adapter's own entry points are called directly. They report
+    // errors through their results, whereas the loader's intercepts and the
+    // layers may throw.
+    directDispatch = UR_RESULT_SUCCESS == result &&
+                     getenv_tobool("UR_ENABLE_DIRECT_DISPATCH") &&
+                     !ur_loader::context->intercept_enabled &&
+                     enabledLayerNames.empty();
+    dispatchDdiTable = urDdiTable;
+
+    if (UR_RESULT_SUCCESS == result) {
+        dispatchReady.store(true, std::memory_order_release);
+    }
+
     return result;
 }
 
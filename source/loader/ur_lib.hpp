@@ -69,6 +69,10 @@ class __urdlllocal context_t {
     ur_result_t urLoaderInit();
     ur_dditable_t urDdiTable = {};
 
+    /// Set once urDdiTable holds the final entry points, layers included, so
+    /// that the exported urGet*ProcAddrTable functions can hand them out
+    std::atomic<bool> dispatchReady{false};
+
     const std::vector<proxy_layer_context_t *> layers = {
         &ur_validation_layer::context,
 #if UR_ENABLE_TRACING
@@ -90,6 +94,17 @@ class __urdlllocal context_t {
 };
 
 extern context_t *context;
+
+/// Copy of the context's urDdiTable once it's complete, which the exported
+/// functions forward to. Kept out of the context so that reaching it takes no
+/// indirection.
+extern __urdlllocal ur_dditable_t dispatchDdiTable;
+
+/// Set with UR_ENABLE_DIRECT_DISPATCH when dispatchDdiTable holds the adapter's
+/// own entry points, which the exported functions then tail-call without
+/// guarding against exceptions.
+extern __urdlllocal bool directDispatch;
+
 ur_result_t urLoaderConfigCreate(ur_loader_config_handle_t *phLoaderConfig);
 ur_result_t urLoaderConfigRetain(ur_loader_config_handle_t hLoaderConfig);
 ur_result_t urLoaderConfigRelease(ur_loader_config_handle_t hLoaderConfig);
@@ -285,15 +285,21 @@ ur_result_t UR_APICALL urAdapterGet(
     ///< ::urAdapterGet shall only retrieve that number of platforms.
     uint32_t *
         pNumAdapters ///< [out][optional] returns the total number of adapters available.
-    ) try {
-    auto pfnAdapterGet = ur_lib::context->urDdiTable.Global.pfnAdapterGet;
+    ) {
+    auto pfnAdapterGet = ur_lib::dispatchDdiTable.Global.pfnAdapterGet;
     if (nullptr == pfnAdapterGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    }
+
+    try {
+        return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -314,16 +320,21 @@ ur_result_t UR_APICALL urAdapterGet(
 ///         + `NULL == hAdapter`
 ur_result_t UR_APICALL urAdapterRelease(
     ur_adapter_handle_t hAdapter ///< [in] Adapter handle to release
-    ) try {
-    auto pfnAdapterRelease =
-        ur_lib::context->urDdiTable.Global.pfnAdapterRelease;
+    ) {
+    auto pfnAdapterRelease = ur_lib::dispatchDdiTable.Global.pfnAdapterRelease;
     if (nullptr == pfnAdapterRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAdapterRelease(hAdapter);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAdapterRelease(hAdapter);
+    }
+
+    try {
+        return pfnAdapterRelease(hAdapter);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -341,15 +352,21 @@ ur_result_t UR_APICALL urAdapterRelease(
 ///         + `NULL == hAdapter`
 ur_result_t UR_APICALL urAdapterRetain(
     ur_adapter_handle_t hAdapter ///< [in] Adapter handle to retain
-    ) try {
-    auto pfnAdapterRetain = ur_lib::context->urDdiTable.Global.pfnAdapterRetain;
+    ) {
+    auto pfnAdapterRetain = ur_lib::dispatchDdiTable.Global.pfnAdapterRetain;
     if (nullptr == pfnAdapterRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAdapterRetain(hAdapter);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAdapterRetain(hAdapter);
+    }
+
+    try {
+        return pfnAdapterRetain(hAdapter);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -403,16 +420,22 @@ ur_result_t UR_APICALL urAdapterGetLastError(
     int32_t *
         pError ///< [out] pointer to an integer where the adapter specific error code will
                ///< be stored.
-    ) try {
+    ) {
     auto pfnAdapterGetLastError =
-        ur_lib::context->urDdiTable.Global.pfnAdapterGetLastError;
+        ur_lib::dispatchDdiTable.Global.pfnAdapterGetLastError;
     if (nullptr == pfnAdapterGetLastError) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+    }
+
+    try {
+        return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -453,17 +476,23 @@ ur_result_t UR_APICALL urAdapterGetInfo(
     ///< returned and pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPropValue.
-    ) try {
-    auto pfnAdapterGetInfo =
-        ur_lib::context->urDdiTable.Global.pfnAdapterGetInfo;
+    ) {
+    auto pfnAdapterGetInfo = ur_lib::dispatchDdiTable.Global.pfnAdapterGetInfo;
     if (nullptr == pfnAdapterGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
-                             pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
+                                 pPropSizeRet);
+    }
+
+    try {
+        return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
+                                 pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -503,16 +532,23 @@ ur_result_t UR_APICALL urPlatformGet(
     ///< ::urPlatformGet shall only retrieve that number of platforms.
     uint32_t *
         pNumPlatforms ///< [out][optional] returns the total number of platforms available.
-    ) try {
-    auto pfnGet = ur_lib::context->urDdiTable.Platform.pfnGet;
+    ) {
+    auto pfnGet = ur_lib::dispatchDdiTable.Platform.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
-                  pNumPlatforms);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
+                      pNumPlatforms);
+    }
+
+    try {
+        return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
+                      pNumPlatforms);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -558,15 +594,23 @@ ur_result_t UR_APICALL urPlatformGetInfo(
     ///< returned and pPlatformInfo is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPlatformInfo.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Platform.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Platform.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hPlatform, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -588,16 +632,21 @@ ur_result_t UR_APICALL urPlatformGetInfo(
 ur_result_t UR_APICALL urPlatformGetApiVersion(
     ur_platform_handle_t hPlatform, ///< [in] handle of the platform
     ur_api_version_t *pVersion      ///< [out] api version
-    ) try {
-    auto pfnGetApiVersion =
-        ur_lib::context->urDdiTable.Platform.pfnGetApiVersion;
+    ) {
+    auto pfnGetApiVersion = ur_lib::dispatchDdiTable.Platform.pfnGetApiVersion;
     if (nullptr == pfnGetApiVersion) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetApiVersion(hPlatform, pVersion);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetApiVersion(hPlatform, pVersion);
+    }
+
+    try {
+        return pfnGetApiVersion(hPlatform, pVersion);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -627,16 +676,22 @@ ur_result_t UR_APICALL urPlatformGetNativeHandle(
     ur_platform_handle_t hPlatform, ///< [in] handle of the platform.
     ur_native_handle_t *
         phNativePlatform ///< [out] a pointer to the native handle of the platform.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Platform.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Platform.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hPlatform, phNativePlatform);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    }
+
+    try {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -668,17 +723,24 @@ ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native platform properties struct.
     ur_platform_handle_t *
         phPlatform ///< [out] pointer to the handle of the platform object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Platform.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Platform.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
-                                     phPlatform);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
+                                         phPlatform);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
+                                         phPlatform);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -713,16 +775,24 @@ ur_result_t UR_APICALL urPlatformGetBackendOption(
     const char **
         ppPlatformOption ///< [out] returns the correct platform specific compiler option based on
                          ///< the frontend option.
-    ) try {
+    ) {
     auto pfnGetBackendOption =
-        ur_lib::context->urDdiTable.Platform.pfnGetBackendOption;
+        ur_lib::dispatchDdiTable.Platform.pfnGetBackendOption;
     if (nullptr == pfnGetBackendOption) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    }
+
+    try {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -771,15 +841,23 @@ ur_result_t UR_APICALL urDeviceGet(
     ///< platform shall only retrieve that number of devices.
     uint32_t *pNumDevices ///< [out][optional] pointer to the number of devices.
     ///< pNumDevices will be updated with the total number of devices available.
-    ) try {
-    auto pfnGet = ur_lib::context->urDdiTable.Device.pfnGet;
+    ) {
+    auto pfnGet = ur_lib::dispatchDdiTable.Device.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    }
+
+    try {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -872,15 +950,23 @@ ur_result_t UR_APICALL urDeviceGetInfo(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Device.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Device.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -912,15 +998,21 @@ ur_result_t UR_APICALL urDeviceGetInfo(
 ur_result_t UR_APICALL urDeviceRetain(
     ur_device_handle_t
         hDevice ///< [in] handle of the device to get a reference of.
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Device.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Device.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hDevice);
+    }
+
+    try {
+        return pfnRetain(hDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -948,15 +1040,21 @@ ur_result_t UR_APICALL urDeviceRetain(
 ///         + `NULL == hDevice`
 ur_result_t UR_APICALL urDeviceRelease(
     ur_device_handle_t hDevice ///< [in] handle of the device to release.
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Device.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Device.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hDevice);
+    }
+
+    try {
+        return pfnRelease(hDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -999,16 +1097,23 @@ ur_result_t UR_APICALL urDevicePartition(
     uint32_t *
         pNumDevicesRet ///< [out][optional] pointer to the number of sub-devices the device can be
     ///< partitioned into according to the partitioning property.
-    ) try {
-    auto pfnPartition = ur_lib::context->urDdiTable.Device.pfnPartition;
+    ) {
+    auto pfnPartition = ur_lib::dispatchDdiTable.Device.pfnPartition;
     if (nullptr == pfnPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
-                        pNumDevicesRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    }
+
+    try {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1048,15 +1153,23 @@ ur_result_t UR_APICALL urDeviceSelectBinary(
     uint32_t *
         pSelectedBinary ///< [out] the index of the selected binary in the input array of binaries.
     ///< If a suitable binary was not found the function returns ::UR_RESULT_ERROR_INVALID_BINARY.
-    ) try {
-    auto pfnSelectBinary = ur_lib::context->urDdiTable.Device.pfnSelectBinary;
+    ) {
+    auto pfnSelectBinary = ur_lib::dispatchDdiTable.Device.pfnSelectBinary;
     if (nullptr == pfnSelectBinary) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    }
+
+    try {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1086,16 +1199,22 @@ ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_device_handle_t hDevice, ///< [in] handle of the device.
     ur_native_handle_t
         *phNativeDevice ///< [out] a pointer to the native handle of the device.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Device.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Device.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hDevice, phNativeDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    }
+
+    try {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1126,17 +1245,24 @@ ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native device properties struct.
     ur_device_handle_t
         *phDevice ///< [out] pointer to the handle of the device object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Device.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Device.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeDevice, hPlatform, pProperties,
-                                     phDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeDevice, hPlatform, pProperties,
+                                         phDevice);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeDevice, hPlatform, pProperties,
+                                         phDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1166,16 +1292,24 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     uint64_t *
         pHostTimestamp ///< [out][optional] pointer to the Host's global timestamp that
                        ///< correlates with the Device's global timestamp value
-    ) try {
+    ) {
     auto pfnGetGlobalTimestamps =
-        ur_lib::context->urDdiTable.Device.pfnGetGlobalTimestamps;
+        ur_lib::dispatchDdiTable.Device.pfnGetGlobalTimestamps;
     if (nullptr == pfnGetGlobalTimestamps) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    }
+
+    try {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1216,15 +1350,21 @@ ur_result_t UR_APICALL urContextCreate(
         pProperties, ///< [in][optional] pointer to context creation properties.
     ur_context_handle_t
         *phContext ///< [out] pointer to handle of context object created
-    ) try {
-    auto pfnCreate = ur_lib::context->urDdiTable.Context.pfnCreate;
+    ) {
+    auto pfnCreate = ur_lib::dispatchDdiTable.Context.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    }
+
+    try {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1252,15 +1392,21 @@ ur_result_t UR_APICALL urContextCreate(
 ur_result_t UR_APICALL urContextRetain(
     ur_context_handle_t
         hContext ///< [in] handle of the context to get a reference of.
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Context.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Context.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hContext);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hContext);
+    }
+
+    try {
+        return pfnRetain(hContext);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1284,15 +1430,21 @@ ur_result_t UR_APICALL urContextRetain(
 ///         + `NULL == hContext`
 ur_result_t UR_APICALL urContextRelease(
     ur_context_handle_t hContext ///< [in] handle of the context to release.
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Context.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Context.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hContext);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hContext);
+    }
+
+    try {
+        return pfnRelease(hContext);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1340,15 +1492,23 @@ ur_result_t UR_APICALL urContextGetInfo(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Context.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Context.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1378,16 +1538,22 @@ ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_context_handle_t hContext, ///< [in] handle of the context.
     ur_native_handle_t *
         phNativeContext ///< [out] a pointer to the native handle of the context.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Context.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Context.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hContext, phNativeContext);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    }
+
+    try {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1419,17 +1585,24 @@ ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native context properties struct
     ur_context_handle_t *
         phContext ///< [out] pointer to the handle of the context object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Context.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Context.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeContext, numDevices, phDevices,
-                                     pProperties, phContext);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeContext, numDevices, phDevices,
+                                         pProperties, phContext);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeContext, numDevices, phDevices,
+                                         pProperties, phContext);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1460,16 +1633,22 @@ ur_result_t UR_APICALL urContextSetExtendedDeleter(
         pfnDeleter, ///< [in] Function pointer to extended deleter.
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
-    ) try {
+    ) {
     auto pfnSetExtendedDeleter =
-        ur_lib::context->urDdiTable.Context.pfnSetExtendedDeleter;
+        ur_lib::dispatchDdiTable.Context.pfnSetExtendedDeleter;
     if (nullptr == pfnSetExtendedDeleter) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    }
+
+    try {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1528,16 +1707,23 @@ ur_result_t UR_APICALL urMemImageCreate(
     const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
     void *pHost,           ///< [in][optional] pointer to the buffer data
     ur_mem_handle_t *phMem ///< [out] pointer to handle of image object created
-    ) try {
-    auto pfnImageCreate = ur_lib::context->urDdiTable.Mem.pfnImageCreate;
+    ) {
+    auto pfnImageCreate = ur_lib::dispatchDdiTable.Mem.pfnImageCreate;
     if (nullptr == pfnImageCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
-                          phMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    }
+
+    try {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1580,15 +1766,21 @@ ur_result_t UR_APICALL urMemBufferCreate(
         *pProperties, ///< [in][optional] pointer to buffer creation properties
     ur_mem_handle_t
         *phBuffer ///< [out] pointer to handle of the memory buffer created
-    ) try {
-    auto pfnBufferCreate = ur_lib::context->urDdiTable.Mem.pfnBufferCreate;
+    ) {
+    auto pfnBufferCreate = ur_lib::dispatchDdiTable.Mem.pfnBufferCreate;
     if (nullptr == pfnBufferCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    }
+
+    try {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1615,15 +1807,21 @@ ur_result_t UR_APICALL urMemBufferCreate(
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 ur_result_t UR_APICALL urMemRetain(
     ur_mem_handle_t hMem ///< [in] handle of the memory object to get access
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Mem.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Mem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hMem);
+    }
+
+    try {
+        return pfnRetain(hMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1645,15 +1843,21 @@ ur_result_t UR_APICALL urMemRetain(
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ur_result_t UR_APICALL urMemRelease(
     ur_mem_handle_t hMem ///< [in] handle of the memory object to release
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Mem.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Mem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hMem);
+    }
+
+    try {
+        return pfnRelease(hMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1694,16 +1898,23 @@ ur_result_t UR_APICALL urMemBufferPartition(
         *pRegion, ///< [in] pointer to buffer create region information
     ur_mem_handle_t
         *phMem ///< [out] pointer to the handle of sub buffer created
-    ) try {
-    auto pfnBufferPartition =
-        ur_lib::context->urDdiTable.Mem.pfnBufferPartition;
+    ) {
+    auto pfnBufferPartition = ur_lib::dispatchDdiTable.Mem.pfnBufferPartition;
     if (nullptr == pfnBufferPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    }
+
+    try {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1739,16 +1950,21 @@ ur_result_t UR_APICALL urMemGetNativeHandle(
                  ///< resident on.
     ur_native_handle_t
         *phNativeMem ///< [out] a pointer to the native handle of the mem.
-    ) try {
-    auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Mem.pfnGetNativeHandle;
+    ) {
+    auto pfnGetNativeHandle = ur_lib::dispatchDdiTable.Mem.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+    }
+
+    try {
+        return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1778,17 +1994,24 @@ ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native memory creation properties.
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of buffer memory object created.
-    ) try {
+    ) {
     auto pfnBufferCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Mem.pfnBufferCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Mem.pfnBufferCreateWithNativeHandle;
     if (nullptr == pfnBufferCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnBufferCreateWithNativeHandle(hNativeMem, hContext, pProperties,
-                                           phMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                               pProperties, phMem);
+    }
+
+    try {
+        return pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                               pProperties, phMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1823,17 +2046,24 @@ ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native memory creation properties.
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of image memory object created.
-    ) try {
+    ) {
     auto pfnImageCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Mem.pfnImageCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Mem.pfnImageCreateWithNativeHandle;
     if (nullptr == pfnImageCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageCreateWithNativeHandle(hNativeMem, hContext, pImageFormat,
-                                          pImageDesc, pProperties, phMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageCreateWithNativeHandle(
+            hNativeMem, hContext, pImageFormat, pImageDesc, pProperties, phMem);
+    }
+
+    try {
+        return pfnImageCreateWithNativeHandle(
+            hNativeMem, hContext, pImageFormat, pImageDesc, pProperties, phMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1880,15 +2110,23 @@ ur_result_t UR_APICALL urMemGetInfo(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Mem.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Mem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1934,16 +2172,23 @@ ur_result_t UR_APICALL urMemImageGetInfo(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
-    auto pfnImageGetInfo = ur_lib::context->urDdiTable.Mem.pfnImageGetInfo;
+    ) {
+    auto pfnImageGetInfo = ur_lib::dispatchDdiTable.Mem.pfnImageGetInfo;
     if (nullptr == pfnImageGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
-                           pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
+    try {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1982,15 +2227,21 @@ ur_result_t UR_APICALL urSamplerCreate(
     const ur_sampler_desc_t *pDesc, ///< [in] pointer to the sampler description
     ur_sampler_handle_t
         *phSampler ///< [out] pointer to handle of sampler object created
-    ) try {
-    auto pfnCreate = ur_lib::context->urDdiTable.Sampler.pfnCreate;
+    ) {
+    auto pfnCreate = ur_lib::dispatchDdiTable.Sampler.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreate(hContext, pDesc, phSampler);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreate(hContext, pDesc, phSampler);
+    }
+
+    try {
+        return pfnCreate(hContext, pDesc, phSampler);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2014,15 +2265,21 @@ ur_result_t UR_APICALL urSamplerCreate(
 ur_result_t UR_APICALL urSamplerRetain(
     ur_sampler_handle_t
         hSampler ///< [in] handle of the sampler object to get access
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Sampler.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Sampler.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hSampler);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hSampler);
+    }
+
+    try {
+        return pfnRetain(hSampler);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2046,15 +2303,21 @@ ur_result_t UR_APICALL urSamplerRetain(
 ur_result_t UR_APICALL urSamplerRelease(
     ur_sampler_handle_t
         hSampler ///< [in] handle of the sampler object to release
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Sampler.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Sampler.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hSampler);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hSampler);
+    }
+
+    try {
+        return pfnRelease(hSampler);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2094,15 +2357,23 @@ ur_result_t UR_APICALL urSamplerGetInfo(
                     ///< property
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in sampler property value
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Sampler.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Sampler.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2132,16 +2403,22 @@ ur_result_t UR_APICALL urSamplerGetNativeHandle(
     ur_sampler_handle_t hSampler, ///< [in] handle of the sampler.
     ur_native_handle_t *
         phNativeSampler ///< [out] a pointer to the native handle of the sampler.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Sampler.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Sampler.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hSampler, phNativeSampler);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    }
+
+    try {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2172,17 +2449,24 @@ ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native sampler properties struct.
     ur_sampler_handle_t *
         phSampler ///< [out] pointer to the handle of the sampler object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Sampler.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Sampler.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
-                                     phSampler);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
+                                         phSampler);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
+                                         phSampler);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2231,15 +2515,21 @@ ur_result_t UR_APICALL urUSMHostAlloc(
     size_t
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM host memory object
-    ) try {
-    auto pfnHostAlloc = ur_lib::context->urDdiTable.USM.pfnHostAlloc;
+    ) {
+    auto pfnHostAlloc = ur_lib::dispatchDdiTable.USM.pfnHostAlloc;
     if (nullptr == pfnHostAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    }
+
+    try {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2290,15 +2580,21 @@ ur_result_t UR_APICALL urUSMDeviceAlloc(
     size_t
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM device memory object
-    ) try {
-    auto pfnDeviceAlloc = ur_lib::context->urDdiTable.USM.pfnDeviceAlloc;
+    ) {
+    auto pfnDeviceAlloc = ur_lib::dispatchDdiTable.USM.pfnDeviceAlloc;
     if (nullptr == pfnDeviceAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
+    try {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2350,15 +2646,21 @@ ur_result_t UR_APICALL urUSMSharedAlloc(
     size_t
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM shared memory object
-    ) try {
-    auto pfnSharedAlloc = ur_lib::context->urDdiTable.USM.pfnSharedAlloc;
+    ) {
+    auto pfnSharedAlloc = ur_lib::dispatchDdiTable.USM.pfnSharedAlloc;
     if (nullptr == pfnSharedAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
+    try {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2378,15 +2680,21 @@ ur_result_t UR_APICALL urUSMSharedAlloc(
 ur_result_t UR_APICALL urUSMFree(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to USM memory object
-    ) try {
-    auto pfnFree = ur_lib::context->urDdiTable.USM.pfnFree;
+    ) {
+    auto pfnFree = ur_lib::dispatchDdiTable.USM.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnFree(hContext, pMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnFree(hContext, pMem);
+    }
+
+    try {
+        return pfnFree(hContext, pMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2419,17 +2727,23 @@ ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                     ///< allocation property
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in USM allocation property
-    ) try {
-    auto pfnGetMemAllocInfo =
-        ur_lib::context->urDdiTable.USM.pfnGetMemAllocInfo;
+    ) {
+    auto pfnGetMemAllocInfo = ur_lib::dispatchDdiTable.USM.pfnGetMemAllocInfo;
     if (nullptr == pfnGetMemAllocInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetMemAllocInfo(hContext, pMem, propName, propSize, pPropValue,
-                              pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2460,15 +2774,21 @@ ur_result_t UR_APICALL urUSMPoolCreate(
         pPoolDesc, ///< [in] pointer to USM pool descriptor. Can be chained with
                    ///< ::ur_usm_pool_limits_desc_t
     ur_usm_pool_handle_t *ppPool ///< [out] pointer to USM memory pool
-    ) try {
-    auto pfnPoolCreate = ur_lib::context->urDdiTable.USM.pfnPoolCreate;
+    ) {
+    auto pfnPoolCreate = ur_lib::dispatchDdiTable.USM.pfnPoolCreate;
     if (nullptr == pfnPoolCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPoolCreate(hContext, pPoolDesc, ppPool);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
+    try {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2483,15 +2803,21 @@ ur_result_t UR_APICALL urUSMPoolCreate(
 ///         + `NULL == pPool`
 ur_result_t UR_APICALL urUSMPoolRetain(
     ur_usm_pool_handle_t pPool ///< [in] pointer to USM memory pool
-    ) try {
-    auto pfnPoolRetain = ur_lib::context->urDdiTable.USM.pfnPoolRetain;
+    ) {
+    auto pfnPoolRetain = ur_lib::dispatchDdiTable.USM.pfnPoolRetain;
     if (nullptr == pfnPoolRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPoolRetain(pPool);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPoolRetain(pPool);
+    }
+
+    try {
+        return pfnPoolRetain(pPool);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2513,15 +2839,21 @@ ur_result_t UR_APICALL urUSMPoolRetain(
 ///         + `NULL == pPool`
 ur_result_t UR_APICALL urUSMPoolRelease(
     ur_usm_pool_handle_t pPool ///< [in] pointer to USM memory pool
-    ) try {
-    auto pfnPoolRelease = ur_lib::context->urDdiTable.USM.pfnPoolRelease;
+    ) {
+    auto pfnPoolRelease = ur_lib::dispatchDdiTable.USM.pfnPoolRelease;
     if (nullptr == pfnPoolRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPoolRelease(pPool);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPoolRelease(pPool);
+    }
+
+    try {
+        return pfnPoolRelease(pPool);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2555,15 +2887,23 @@ ur_result_t UR_APICALL urUSMPoolGetInfo(
                     ///< property
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in pool property value
-    ) try {
-    auto pfnPoolGetInfo = ur_lib::context->urDdiTable.USM.pfnPoolGetInfo;
+    ) {
+    auto pfnPoolGetInfo = ur_lib::dispatchDdiTable.USM.pfnPoolGetInfo;
     if (nullptr == pfnPoolGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPoolGetInfo(hPool, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPoolGetInfo(hPool, propName, propSize, pPropValue,
+                              pPropSizeRet);
+    }
+
+    try {
+        return pfnPoolGetInfo(hPool, propName, propSize, pPropValue,
+                              pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2607,17 +2947,24 @@ ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     ///< returned and pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
-    ) try {
+    ) {
     auto pfnGranularityGetInfo =
-        ur_lib::context->urDdiTable.VirtualMem.pfnGranularityGetInfo;
+        ur_lib::dispatchDdiTable.VirtualMem.pfnGranularityGetInfo;
     if (nullptr == pfnGranularityGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
-                                 pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
+                                     pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
+                                     pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2643,15 +2990,21 @@ ur_result_t UR_APICALL urVirtualMemReserve(
     void **
         ppStart ///< [out] pointer to the returned address at the start of reserved virtual
                 ///< memory range.
-    ) try {
-    auto pfnReserve = ur_lib::context->urDdiTable.VirtualMem.pfnReserve;
+    ) {
+    auto pfnReserve = ur_lib::dispatchDdiTable.VirtualMem.pfnReserve;
     if (nullptr == pfnReserve) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReserve(hContext, pStart, size, ppStart);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReserve(hContext, pStart, size, ppStart);
+    }
+
+    try {
+        return pfnReserve(hContext, pStart, size, ppStart);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2671,15 +3024,21 @@ ur_result_t UR_APICALL urVirtualMemFree(
     const void *
         pStart, ///< [in] pointer to the start of the virtual memory range to free.
     size_t size ///< [in] size in bytes of the virtual memory range to free.
-    ) try {
-    auto pfnFree = ur_lib::context->urDdiTable.VirtualMem.pfnFree;
+    ) {
+    auto pfnFree = ur_lib::dispatchDdiTable.VirtualMem.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnFree(hContext, pStart, size);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnFree(hContext, pStart, size);
+    }
+
+    try {
+        return pfnFree(hContext, pStart, size);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2708,15 +3067,21 @@ ur_result_t UR_APICALL urVirtualMemMap(
         offset, ///< [in] offset in bytes into the physical memory to map pStart to.
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags for the physical memory mapping.
-    ) try {
-    auto pfnMap = ur_lib::context->urDdiTable.VirtualMem.pfnMap;
+    ) {
+    auto pfnMap = ur_lib::dispatchDdiTable.VirtualMem.pfnMap;
     if (nullptr == pfnMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+    }
+
+    try {
+        return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2740,15 +3105,21 @@ ur_result_t UR_APICALL urVirtualMemUnmap(
     const void *
         pStart, ///< [in] pointer to the start of the mapped virtual memory range
     size_t size ///< [in] size in bytes of the virtual memory range.
-    ) try {
-    auto pfnUnmap = ur_lib::context->urDdiTable.VirtualMem.pfnUnmap;
+    ) {
+    auto pfnUnmap = ur_lib::dispatchDdiTable.VirtualMem.pfnUnmap;
     if (nullptr == pfnUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUnmap(hContext, pStart, size);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUnmap(hContext, pStart, size);
+    }
+
+    try {
+        return pfnUnmap(hContext, pStart, size);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2772,15 +3143,21 @@ ur_result_t UR_APICALL urVirtualMemSetAccess(
     size_t size, ///< [in] size in bytes of the virtual memory range.
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags to set for the mapped virtual memory range.
-    ) try {
-    auto pfnSetAccess = ur_lib::context->urDdiTable.VirtualMem.pfnSetAccess;
+    ) {
+    auto pfnSetAccess = ur_lib::dispatchDdiTable.VirtualMem.pfnSetAccess;
     if (nullptr == pfnSetAccess) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetAccess(hContext, pStart, size, flags);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetAccess(hContext, pStart, size, flags);
+    }
+
+    try {
+        return pfnSetAccess(hContext, pStart, size, flags);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2812,16 +3189,23 @@ ur_result_t UR_APICALL urVirtualMemGetInfo(
     ///< returned and pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.VirtualMem.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.VirtualMem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hContext, pStart, size, propName, propSize, pPropValue,
-                      pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hContext, pStart, size, propName, propSize,
+                          pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hContext, pStart, size, propName, propSize,
+                          pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2851,15 +3235,21 @@ ur_result_t UR_APICALL urPhysicalMemCreate(
         pProperties, ///< [in][optional] pointer to physical memory creation properties.
     ur_physical_mem_handle_t *
         phPhysicalMem ///< [out] pointer to handle of physical memory object created.
-    ) try {
-    auto pfnCreate = ur_lib::context->urDdiTable.PhysicalMem.pfnCreate;
+    ) {
+    auto pfnCreate = ur_lib::dispatchDdiTable.PhysicalMem.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+    }
+
+    try {
+        return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2875,15 +3265,21 @@ ur_result_t UR_APICALL urPhysicalMemCreate(
 ur_result_t UR_APICALL urPhysicalMemRetain(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in] handle of the physical memory object to retain.
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.PhysicalMem.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.PhysicalMem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hPhysicalMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hPhysicalMem);
+    }
+
+    try {
+        return pfnRetain(hPhysicalMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2899,15 +3295,21 @@ ur_result_t UR_APICALL urPhysicalMemRetain(
 ur_result_t UR_APICALL urPhysicalMemRelease(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in] handle of the physical memory object to release.
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.PhysicalMem.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.PhysicalMem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hPhysicalMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hPhysicalMem);
+    }
+
+    try {
+        return pfnRelease(hPhysicalMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2948,15 +3350,21 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
         pProperties, ///< [in][optional] pointer to program creation properties.
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of program object created.
-    ) try {
-    auto pfnCreateWithIL = ur_lib::context->urDdiTable.Program.pfnCreateWithIL;
+    ) {
+    auto pfnCreateWithIL = ur_lib::dispatchDdiTable.Program.pfnCreateWithIL;
     if (nullptr == pfnCreateWithIL) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    }
+
+    try {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3002,17 +3410,24 @@ ur_result_t UR_APICALL urProgramCreateWithBinary(
         pProperties, ///< [in][optional] pointer to program creation properties.
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of Program object created.
-    ) try {
+    ) {
     auto pfnCreateWithBinary =
-        ur_lib::context->urDdiTable.Program.pfnCreateWithBinary;
+        ur_lib::dispatchDdiTable.Program.pfnCreateWithBinary;
     if (nullptr == pfnCreateWithBinary) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithBinary(hContext, hDevice, size, pBinary, pProperties,
-                               phProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    }
+
+    try {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3046,15 +3461,21 @@ ur_result_t UR_APICALL urProgramBuild(
     ur_program_handle_t hProgram, ///< [in] Handle of the program to build.
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
-    ) try {
-    auto pfnBuild = ur_lib::context->urDdiTable.Program.pfnBuild;
+    ) {
+    auto pfnBuild = ur_lib::dispatchDdiTable.Program.pfnBuild;
     if (nullptr == pfnBuild) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnBuild(hContext, hProgram, pOptions);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnBuild(hContext, hProgram, pOptions);
+    }
+
+    try {
+        return pfnBuild(hContext, hProgram, pOptions);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3088,15 +3509,21 @@ ur_result_t UR_APICALL urProgramCompile(
         hProgram, ///< [in][out] handle of the program to compile.
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
-    ) try {
-    auto pfnCompile = ur_lib::context->urDdiTable.Program.pfnCompile;
+    ) {
+    auto pfnCompile = ur_lib::dispatchDdiTable.Program.pfnCompile;
     if (nullptr == pfnCompile) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCompile(hContext, hProgram, pOptions);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCompile(hContext, hProgram, pOptions);
+    }
+
+    try {
+        return pfnCompile(hContext, hProgram, pOptions);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3138,15 +3565,21 @@ ur_result_t UR_APICALL urProgramLink(
         pOptions, ///< [in][optional] pointer to linker options null-terminated string.
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of program object created.
-    ) try {
-    auto pfnLink = ur_lib::context->urDdiTable.Program.pfnLink;
+    ) {
+    auto pfnLink = ur_lib::dispatchDdiTable.Program.pfnLink;
     if (nullptr == pfnLink) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    }
+
+    try {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3171,15 +3604,21 @@ ur_result_t UR_APICALL urProgramLink(
 ///         + `NULL == hProgram`
 ur_result_t UR_APICALL urProgramRetain(
     ur_program_handle_t hProgram ///< [in] handle for the Program to retain
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Program.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Program.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hProgram);
+    }
+
+    try {
+        return pfnRetain(hProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3204,15 +3643,21 @@ ur_result_t UR_APICALL urProgramRetain(
 ///         + `NULL == hProgram`
 ur_result_t UR_APICALL urProgramRelease(
     ur_program_handle_t hProgram ///< [in] handle for the Program to release
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Program.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Program.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hProgram);
+    }
+
+    try {
+        return pfnRelease(hProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3253,17 +3698,24 @@ ur_result_t UR_APICALL urProgramGetFunctionPointer(
         pFunctionName, ///< [in] A null-terminates string denoting the mangled function name.
     void **
         ppFunctionPointer ///< [out] Returns the pointer to the function if it is found in the program.
-    ) try {
+    ) {
     auto pfnGetFunctionPointer =
-        ur_lib::context->urDdiTable.Program.pfnGetFunctionPointer;
+        ur_lib::dispatchDdiTable.Program.pfnGetFunctionPointer;
     if (nullptr == pfnGetFunctionPointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
-                                 ppFunctionPointer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    }
+
+    try {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3304,18 +3756,26 @@ ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
                                 ///< in the program.
     void **
         ppGlobalVariablePointerRet ///< [out] Returns the pointer to the global variable if it is found in the program.
-    ) try {
+    ) {
     auto pfnGetGlobalVariablePointer =
-        ur_lib::context->urDdiTable.Program.pfnGetGlobalVariablePointer;
+        ur_lib::dispatchDdiTable.Program.pfnGetGlobalVariablePointer;
     if (nullptr == pfnGetGlobalVariablePointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetGlobalVariablePointer(hDevice, hProgram, pGlobalVariableName,
-                                       pGlobalVariableSizeRet,
-                                       ppGlobalVariablePointerRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetGlobalVariablePointer(
+            hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+            ppGlobalVariablePointerRet);
+    }
+
+    try {
+        return pfnGetGlobalVariablePointer(
+            hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+            ppGlobalVariablePointerRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3358,15 +3818,23 @@ ur_result_t UR_APICALL urProgramGetInfo(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Program.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Program.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3401,16 +3869,23 @@ ur_result_t UR_APICALL urProgramGetBuildInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
-    ) try {
-    auto pfnGetBuildInfo = ur_lib::context->urDdiTable.Program.pfnGetBuildInfo;
+    ) {
+    auto pfnGetBuildInfo = ur_lib::dispatchDdiTable.Program.pfnGetBuildInfo;
     if (nullptr == pfnGetBuildInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetBuildInfo(hProgram, hDevice, propName, propSize, pPropValue,
-                           pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3442,16 +3917,22 @@ ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     const ur_specialization_constant_info_t *
         pSpecConstants ///< [in][range(0, count)] array of specialization constant value
                        ///< descriptions
-    ) try {
+    ) {
     auto pfnSetSpecializationConstants =
-        ur_lib::context->urDdiTable.Program.pfnSetSpecializationConstants;
+        ur_lib::dispatchDdiTable.Program.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    }
+
+    try {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3481,16 +3962,22 @@ ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_program_handle_t hProgram, ///< [in] handle of the program.
     ur_native_handle_t *
         phNativeProgram ///< [out] a pointer to the native handle of the program.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Program.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Program.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hProgram, phNativeProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    }
+
+    try {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3521,17 +4008,24 @@ ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native program properties struct.
     ur_program_handle_t *
         phProgram ///< [out] pointer to the handle of the program object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Program.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Program.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
-                                     phProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
+                                         phProgram);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
+                                         phProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3558,15 +4052,21 @@ ur_result_t UR_APICALL urKernelCreate(
     const char *pKernelName,      ///< [in] pointer to null-terminated string.
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to handle of kernel object created.
-    ) try {
-    auto pfnCreate = ur_lib::context->urDdiTable.Kernel.pfnCreate;
+    ) {
+    auto pfnCreate = ur_lib::dispatchDdiTable.Kernel.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreate(hProgram, pKernelName, phKernel);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    }
+
+    try {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3596,15 +4096,23 @@ ur_result_t UR_APICALL urKernelSetArgValue(
         *pProperties, ///< [in][optional] pointer to value properties.
     const void
         *pArgValue ///< [in] argument value represented as matching arg type.
-    ) try {
-    auto pfnSetArgValue = ur_lib::context->urDdiTable.Kernel.pfnSetArgValue;
+    ) {
+    auto pfnSetArgValue = ur_lib::dispatchDdiTable.Kernel.pfnSetArgValue;
     if (nullptr == pfnSetArgValue) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pProperties,
+                              pArgValue);
+    }
+
+    try {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pProperties,
+                              pArgValue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3631,15 +4139,21 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
         argSize, ///< [in] size of the local buffer to be allocated by the runtime
     const ur_kernel_arg_local_properties_t
         *pProperties ///< [in][optional] pointer to local buffer properties.
-    ) try {
-    auto pfnSetArgLocal = ur_lib::context->urDdiTable.Kernel.pfnSetArgLocal;
+    ) {
+    auto pfnSetArgLocal = ur_lib::dispatchDdiTable.Kernel.pfnSetArgLocal;
     if (nullptr == pfnSetArgLocal) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+    }
+
+    try {
+        return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3683,15 +4197,23 @@ ur_result_t UR_APICALL urKernelGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Kernel.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Kernel.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3723,16 +4245,23 @@ ur_result_t UR_APICALL urKernelGetGroupInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
-    ) try {
-    auto pfnGetGroupInfo = ur_lib::context->urDdiTable.Kernel.pfnGetGroupInfo;
+    ) {
+    auto pfnGetGroupInfo = ur_lib::dispatchDdiTable.Kernel.pfnGetGroupInfo;
     if (nullptr == pfnGetGroupInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
-                           pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
+    try {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3760,17 +4289,24 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
-    ) try {
+    ) {
     auto pfnGetSubGroupInfo =
-        ur_lib::context->urDdiTable.Kernel.pfnGetSubGroupInfo;
+        ur_lib::dispatchDdiTable.Kernel.pfnGetSubGroupInfo;
     if (nullptr == pfnGetSubGroupInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
-                              pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3795,15 +4331,21 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
 ///         + `NULL == hKernel`
 ur_result_t UR_APICALL urKernelRetain(
     ur_kernel_handle_t hKernel ///< [in] handle for the Kernel to retain
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Kernel.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Kernel.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hKernel);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hKernel);
+    }
+
+    try {
+        return pfnRetain(hKernel);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3828,15 +4370,21 @@ ur_result_t UR_APICALL urKernelRetain(
 ///         + `NULL == hKernel`
 ur_result_t UR_APICALL urKernelRelease(
     ur_kernel_handle_t hKernel ///< [in] handle for the Kernel to release
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Kernel.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Kernel.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hKernel);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hKernel);
+    }
+
+    try {
+        return pfnRelease(hKernel);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3868,15 +4416,21 @@ ur_result_t UR_APICALL urKernelSetArgPointer(
     const void *
         pArgValue ///< [in][optional] Pointer obtained by USM allocation or virtual memory
     ///< mapping operation. If null then argument value is considered null.
-    ) try {
-    auto pfnSetArgPointer = ur_lib::context->urDdiTable.Kernel.pfnSetArgPointer;
+    ) {
+    auto pfnSetArgPointer = ur_lib::dispatchDdiTable.Kernel.pfnSetArgPointer;
     if (nullptr == pfnSetArgPointer) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+    }
+
+    try {
+        return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3911,15 +4465,23 @@ ur_result_t UR_APICALL urKernelSetExecInfo(
     const void *
         pPropValue ///< [in][typename(propName, propSize)] pointer to memory location holding
                    ///< the property value.
-    ) try {
-    auto pfnSetExecInfo = ur_lib::context->urDdiTable.Kernel.pfnSetExecInfo;
+    ) {
+    auto pfnSetExecInfo = ur_lib::dispatchDdiTable.Kernel.pfnSetExecInfo;
     if (nullptr == pfnSetExecInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetExecInfo(hKernel, propName, propSize, pProperties,
+                              pPropValue);
+    }
+
+    try {
+        return pfnSetExecInfo(hKernel, propName, propSize, pProperties,
+                              pPropValue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3945,15 +4507,21 @@ ur_result_t UR_APICALL urKernelSetArgSampler(
     const ur_kernel_arg_sampler_properties_t
         *pProperties, ///< [in][optional] pointer to sampler properties.
     ur_sampler_handle_t hArgValue ///< [in] handle of Sampler object.
-    ) try {
-    auto pfnSetArgSampler = ur_lib::context->urDdiTable.Kernel.pfnSetArgSampler;
+    ) {
+    auto pfnSetArgSampler = ur_lib::dispatchDdiTable.Kernel.pfnSetArgSampler;
     if (nullptr == pfnSetArgSampler) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+    }
+
+    try {
+        return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3980,15 +4548,21 @@ ur_result_t UR_APICALL urKernelSetArgMemObj(
     const ur_kernel_arg_mem_obj_properties_t
         *pProperties, ///< [in][optional] pointer to Memory object properties.
     ur_mem_handle_t hArgValue ///< [in][optional] handle of Memory object.
-    ) try {
-    auto pfnSetArgMemObj = ur_lib::context->urDdiTable.Kernel.pfnSetArgMemObj;
+    ) {
+    auto pfnSetArgMemObj = ur_lib::dispatchDdiTable.Kernel.pfnSetArgMemObj;
     if (nullptr == pfnSetArgMemObj) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+    }
+
+    try {
+        return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4026,16 +4600,22 @@ ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     uint32_t count, ///< [in] the number of elements in the pSpecConstants array
     const ur_specialization_constant_info_t *
         pSpecConstants ///< [in] array of specialization constant value descriptions
-    ) try {
+    ) {
     auto pfnSetSpecializationConstants =
-        ur_lib::context->urDdiTable.Kernel.pfnSetSpecializationConstants;
+        ur_lib::dispatchDdiTable.Kernel.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    }
+
+    try {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4065,16 +4645,22 @@ ur_result_t UR_APICALL urKernelGetNativeHandle(
     ur_kernel_handle_t hKernel, ///< [in] handle of the kernel.
     ur_native_handle_t
         *phNativeKernel ///< [out] a pointer to the native handle of the kernel.
-    ) try {
+    ) {
     auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Kernel.pfnGetNativeHandle;
+        ur_lib::dispatchDdiTable.Kernel.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hKernel, phNativeKernel);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    }
+
+    try {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4108,17 +4694,24 @@ ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native kernel properties struct
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to the handle of the kernel object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Kernel.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Kernel.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
-                                     pProperties, phKernel);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4159,18 +4752,26 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     size_t *
         pSuggestedLocalWorkSize ///< [out] pointer to an array of numWorkDim unsigned values that specify
     ///< suggested local work size that will contain the result of the query
-    ) try {
+    ) {
     auto pfnGetSuggestedLocalWorkSize =
-        ur_lib::context->urDdiTable.Kernel.pfnGetSuggestedLocalWorkSize;
+        ur_lib::dispatchDdiTable.Kernel.pfnGetSuggestedLocalWorkSize;
     if (nullptr == pfnGetSuggestedLocalWorkSize) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
-                                        pGlobalWorkOffset, pGlobalWorkSize,
-                                        pSuggestedLocalWorkSize);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pSuggestedLocalWorkSize);
+    }
+
+    try {
+        return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pSuggestedLocalWorkSize);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4210,15 +4811,21 @@ ur_result_t UR_APICALL urQueueGetInfo(
                     ///< property
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in queue property value
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Queue.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Queue.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4257,15 +4864,21 @@ ur_result_t UR_APICALL urQueueCreate(
         *pProperties, ///< [in][optional] pointer to queue creation properties.
     ur_queue_handle_t
         *phQueue ///< [out] pointer to handle of queue object created
-    ) try {
-    auto pfnCreate = ur_lib::context->urDdiTable.Queue.pfnCreate;
+    ) {
+    auto pfnCreate = ur_lib::dispatchDdiTable.Queue.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreate(hContext, hDevice, pProperties, phQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    }
+
+    try {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4292,15 +4905,21 @@ ur_result_t UR_APICALL urQueueCreate(
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 ur_result_t UR_APICALL urQueueRetain(
     ur_queue_handle_t hQueue ///< [in] handle of the queue object to get access
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Queue.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Queue.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hQueue);
+    }
+
+    try {
+        return pfnRetain(hQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4329,15 +4948,21 @@ ur_result_t UR_APICALL urQueueRetain(
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 ur_result_t UR_APICALL urQueueRelease(
     ur_queue_handle_t hQueue ///< [in] handle of the queue object to release
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Queue.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Queue.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hQueue);
+    }
+
+    try {
+        return pfnRelease(hQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4369,16 +4994,21 @@ ur_result_t UR_APICALL urQueueGetNativeHandle(
         *pDesc, ///< [in][optional] pointer to native descriptor
     ur_native_handle_t
         *phNativeQueue ///< [out] a pointer to the native handle of the queue.
-    ) try {
-    auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Queue.pfnGetNativeHandle;
+    ) {
+    auto pfnGetNativeHandle = ur_lib::dispatchDdiTable.Queue.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    }
+
+    try {
+        return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4411,17 +5041,24 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native queue properties struct
     ur_queue_handle_t
         *phQueue ///< [out] pointer to the handle of the queue object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Queue.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Queue.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
-                                     pProperties, phQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
+                                         pProperties, phQueue);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
+                                         pProperties, phQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4450,15 +5087,21 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ur_result_t UR_APICALL urQueueFinish(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
-    ) try {
-    auto pfnFinish = ur_lib::context->urDdiTable.Queue.pfnFinish;
+    ) {
+    auto pfnFinish = ur_lib::dispatchDdiTable.Queue.pfnFinish;
     if (nullptr == pfnFinish) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnFinish(hQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnFinish(hQueue);
+    }
+
+    try {
+        return pfnFinish(hQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4486,15 +5129,21 @@ ur_result_t UR_APICALL urQueueFinish(
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ur_result_t UR_APICALL urQueueFlush(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be flushed.
-    ) try {
-    auto pfnFlush = ur_lib::context->urDdiTable.Queue.pfnFlush;
+    ) {
+    auto pfnFlush = ur_lib::dispatchDdiTable.Queue.pfnFlush;
     if (nullptr == pfnFlush) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnFlush(hQueue);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnFlush(hQueue);
+    }
+
+    try {
+        return pfnFlush(hQueue);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4532,15 +5181,21 @@ ur_result_t UR_APICALL urEventGetInfo(
         pPropValue, ///< [out][optional][typename(propName, propSize)] value of the event
                     ///< property
     size_t *pPropSizeRet ///< [out][optional] bytes returned in event property
-    ) try {
-    auto pfnGetInfo = ur_lib::context->urDdiTable.Event.pfnGetInfo;
+    ) {
+    auto pfnGetInfo = ur_lib::dispatchDdiTable.Event.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4578,17 +5233,24 @@ ur_result_t UR_APICALL urEventGetProfilingInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes returned in
                      ///< propValue
-    ) try {
+    ) {
     auto pfnGetProfilingInfo =
-        ur_lib::context->urDdiTable.Event.pfnGetProfilingInfo;
+        ur_lib::dispatchDdiTable.Event.pfnGetProfilingInfo;
     if (nullptr == pfnGetProfilingInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
-                               pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    }
+
+    try {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4618,15 +5280,21 @@ ur_result_t UR_APICALL urEventWait(
     const ur_event_handle_t *
         phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
                         ///< completion
-    ) try {
-    auto pfnWait = ur_lib::context->urDdiTable.Event.pfnWait;
+    ) {
+    auto pfnWait = ur_lib::dispatchDdiTable.Event.pfnWait;
     if (nullptr == pfnWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnWait(numEvents, phEventWaitList);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnWait(numEvents, phEventWaitList);
+    }
+
+    try {
+        return pfnWait(numEvents, phEventWaitList);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4649,15 +5317,21 @@ ur_result_t UR_APICALL urEventWait(
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ur_result_t UR_APICALL urEventRetain(
     ur_event_handle_t hEvent ///< [in] handle of the event object
-    ) try {
-    auto pfnRetain = ur_lib::context->urDdiTable.Event.pfnRetain;
+    ) {
+    auto pfnRetain = ur_lib::dispatchDdiTable.Event.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetain(hEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetain(hEvent);
+    }
+
+    try {
+        return pfnRetain(hEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4680,15 +5354,21 @@ ur_result_t UR_APICALL urEventRetain(
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ur_result_t UR_APICALL urEventRelease(
     ur_event_handle_t hEvent ///< [in] handle of the event object
-    ) try {
-    auto pfnRelease = ur_lib::context->urDdiTable.Event.pfnRelease;
+    ) {
+    auto pfnRelease = ur_lib::dispatchDdiTable.Event.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRelease(hEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRelease(hEvent);
+    }
+
+    try {
+        return pfnRelease(hEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4718,16 +5398,21 @@ ur_result_t UR_APICALL urEventGetNativeHandle(
     ur_event_handle_t hEvent, ///< [in] handle of the event.
     ur_native_handle_t
         *phNativeEvent ///< [out] a pointer to the native handle of the event.
-    ) try {
-    auto pfnGetNativeHandle =
-        ur_lib::context->urDdiTable.Event.pfnGetNativeHandle;
+    ) {
+    auto pfnGetNativeHandle = ur_lib::dispatchDdiTable.Event.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetNativeHandle(hEvent, phNativeEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    }
+
+    try {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4758,17 +5443,24 @@ ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         pProperties, ///< [in][optional] pointer to native event properties struct
     ur_event_handle_t
         *phEvent ///< [out] pointer to the handle of the event object created.
-    ) try {
+    ) {
     auto pfnCreateWithNativeHandle =
-        ur_lib::context->urDdiTable.Event.pfnCreateWithNativeHandle;
+        ur_lib::dispatchDdiTable.Event.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
-                                     phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
+                                         phEvent);
+    }
+
+    try {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
+                                         phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4804,15 +5496,21 @@ ur_result_t UR_APICALL urEventSetCallback(
     ur_event_callback_t pfnNotify,  ///< [in] execution status of the event
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
-    ) try {
-    auto pfnSetCallback = ur_lib::context->urDdiTable.Event.pfnSetCallback;
+    ) {
+    auto pfnSetCallback = ur_lib::dispatchDdiTable.Event.pfnSetCallback;
     if (nullptr == pfnSetCallback) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    }
+
+    try {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4876,17 +5574,25 @@ ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
-    auto pfnKernelLaunch = ur_lib::context->urDdiTable.Enqueue.pfnKernelLaunch;
+    ) {
+    auto pfnKernelLaunch = ur_lib::dispatchDdiTable.Enqueue.pfnKernelLaunch;
     if (nullptr == pfnKernelLaunch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
-                           pGlobalWorkSize, pLocalWorkSize, numEventsInWaitList,
-                           phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4932,15 +5638,23 @@ ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnEventsWait = ur_lib::context->urDdiTable.Enqueue.pfnEventsWait;
+    ) {
+    auto pfnEventsWait = ur_lib::dispatchDdiTable.Enqueue.pfnEventsWait;
     if (nullptr == pfnEventsWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    }
+
+    try {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4988,17 +5702,24 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnEventsWaitWithBarrier =
-        ur_lib::context->urDdiTable.Enqueue.pfnEventsWaitWithBarrier;
+        ur_lib::dispatchDdiTable.Enqueue.pfnEventsWaitWithBarrier;
     if (nullptr == pfnEventsWaitWithBarrier) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                    phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5052,17 +5773,25 @@ ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemBufferRead =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferRead;
+    ) {
+    auto pfnMemBufferRead = ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferRead;
     if (nullptr == pfnMemBufferRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
-                            numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
+    try {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5118,17 +5847,25 @@ ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemBufferWrite =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferWrite;
+    ) {
+    auto pfnMemBufferWrite = ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferWrite;
     if (nullptr == pfnMemBufferWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
-                             numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    }
+
+    try {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5204,19 +5941,28 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnMemBufferReadRect =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferReadRect;
+        ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferReadRect;
     if (nullptr == pfnMemBufferReadRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferReadRect(
-        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-        numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferReadRect(
+            hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pDst, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemBufferReadRect(
+            hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pDst, numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5295,19 +6041,28 @@ ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnMemBufferWriteRect =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferWriteRect;
+        ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferWriteRect;
     if (nullptr == pfnMemBufferWriteRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferWriteRect(
-        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-        numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferWriteRect(
+            hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemBufferWriteRect(
+            hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5358,18 +6113,25 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemBufferCopy =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferCopy;
+    ) {
+    auto pfnMemBufferCopy = ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferCopy;
     if (nullptr == pfnMemBufferCopy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
-                            dstOffset, size, numEventsInWaitList,
-                            phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5437,19 +6199,28 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnMemBufferCopyRect =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferCopyRect;
+        ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferCopyRect;
     if (nullptr == pfnMemBufferCopyRect) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferCopyRect(hQueue, hBufferSrc, hBufferDst, srcOrigin,
-                                dstOrigin, region, srcRowPitch, srcSlicePitch,
-                                dstRowPitch, dstSlicePitch, numEventsInWaitList,
-                                phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferCopyRect(
+            hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+            srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemBufferCopyRect(
+            hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+            srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5505,18 +6276,25 @@ ur_result_t UR_APICALL urEnqueueMemBufferFill(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemBufferFill =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemBufferFill;
+    ) {
+    auto pfnMemBufferFill = ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferFill;
     if (nullptr == pfnMemBufferFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
-                            size, numEventsInWaitList, phEventWaitList,
-                            phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
+    try {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5576,17 +6354,25 @@ ur_result_t UR_APICALL urEnqueueMemImageRead(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemImageRead = ur_lib::context->urDdiTable.Enqueue.pfnMemImageRead;
+    ) {
+    auto pfnMemImageRead = ur_lib::dispatchDdiTable.Enqueue.pfnMemImageRead;
     if (nullptr == pfnMemImageRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
-                           rowPitch, slicePitch, pDst, numEventsInWaitList,
-                           phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5647,18 +6433,25 @@ ur_result_t UR_APICALL urEnqueueMemImageWrite(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemImageWrite =
-        ur_lib::context->urDdiTable.Enqueue.pfnMemImageWrite;
+    ) {
+    auto pfnMemImageWrite = ur_lib::dispatchDdiTable.Enqueue.pfnMemImageWrite;
     if (nullptr == pfnMemImageWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
-                            rowPitch, slicePitch, pSrc, numEventsInWaitList,
-                            phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5714,17 +6507,25 @@ ur_result_t UR_APICALL urEnqueueMemImageCopy(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemImageCopy = ur_lib::context->urDdiTable.Enqueue.pfnMemImageCopy;
+    ) {
+    auto pfnMemImageCopy = ur_lib::dispatchDdiTable.Enqueue.pfnMemImageCopy;
     if (nullptr == pfnMemImageCopy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
-                           region, numEventsInWaitList, phEventWaitList,
-                           phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5786,17 +6587,25 @@ ur_result_t UR_APICALL urEnqueueMemBufferMap(
                  ///< command instance.
     void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
                     ///< numEventsInWaitList?
-    ) try {
-    auto pfnMemBufferMap = ur_lib::context->urDdiTable.Enqueue.pfnMemBufferMap;
+    ) {
+    auto pfnMemBufferMap = ur_lib::dispatchDdiTable.Enqueue.pfnMemBufferMap;
     if (nullptr == pfnMemBufferMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset, size,
-                           numEventsInWaitList, phEventWaitList, phEvent,
-                           ppRetMap);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    }
+
+    try {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5842,16 +6651,23 @@ ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnMemUnmap = ur_lib::context->urDdiTable.Enqueue.pfnMemUnmap;
+    ) {
+    auto pfnMemUnmap = ur_lib::dispatchDdiTable.Enqueue.pfnMemUnmap;
     if (nullptr == pfnMemUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
-                       phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5903,16 +6719,23 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnUSMFill = ur_lib::context->urDdiTable.Enqueue.pfnUSMFill;
+    ) {
+    auto pfnUSMFill = ur_lib::dispatchDdiTable.Enqueue.pfnUSMFill;
     if (nullptr == pfnUSMFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
-                      numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5959,16 +6782,23 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnUSMMemcpy = ur_lib::context->urDdiTable.Enqueue.pfnUSMMemcpy;
+    ) {
+    auto pfnUSMMemcpy = ur_lib::dispatchDdiTable.Enqueue.pfnUSMMemcpy;
     if (nullptr == pfnUSMMemcpy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
-                        phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6019,16 +6849,23 @@ ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnUSMPrefetch = ur_lib::context->urDdiTable.Enqueue.pfnUSMPrefetch;
+    ) {
+    auto pfnUSMPrefetch = ur_lib::dispatchDdiTable.Enqueue.pfnUSMPrefetch;
     if (nullptr == pfnUSMPrefetch) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
-                          phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6067,15 +6904,21 @@ ur_result_t UR_APICALL urEnqueueUSMAdvise(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
-    auto pfnUSMAdvise = ur_lib::context->urDdiTable.Enqueue.pfnUSMAdvise;
+    ) {
+    auto pfnUSMAdvise = ur_lib::dispatchDdiTable.Enqueue.pfnUSMAdvise;
     if (nullptr == pfnUSMAdvise) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    }
+
+    try {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6135,16 +6978,25 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
-    auto pfnUSMFill2D = ur_lib::context->urDdiTable.Enqueue.pfnUSMFill2D;
+    ) {
+    auto pfnUSMFill2D = ur_lib::dispatchDdiTable.Enqueue.pfnUSMFill2D;
     if (nullptr == pfnUSMFill2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
-                        height, numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    }
+
+    try {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6201,17 +7053,25 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
-    auto pfnUSMMemcpy2D = ur_lib::context->urDdiTable.Enqueue.pfnUSMMemcpy2D;
+    ) {
+    auto pfnUSMMemcpy2D = ur_lib::dispatchDdiTable.Enqueue.pfnUSMMemcpy2D;
     if (nullptr == pfnUSMMemcpy2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
-                          width, height, numEventsInWaitList, phEventWaitList,
-                          phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6255,18 +7115,26 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
+    ) {
     auto pfnDeviceGlobalVariableWrite =
-        ur_lib::context->urDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
+        ur_lib::dispatchDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
     if (nullptr == pfnDeviceGlobalVariableWrite) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnDeviceGlobalVariableWrite(
-        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
-        numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnDeviceGlobalVariableWrite(
+            hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnDeviceGlobalVariableWrite(
+            hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6310,18 +7178,26 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
+    ) {
     auto pfnDeviceGlobalVariableRead =
-        ur_lib::context->urDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
+        ur_lib::dispatchDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
     if (nullptr == pfnDeviceGlobalVariableRead) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
-                                       count, offset, pDst, numEventsInWaitList,
-                                       phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnDeviceGlobalVariableRead(
+            hQueue, hProgram, name, blockingRead, count, offset, pDst,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnDeviceGlobalVariableRead(
+            hQueue, hProgram, name, blockingRead, count, offset, pDst,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6368,16 +7244,25 @@ ur_result_t UR_APICALL urEnqueueReadHostPipe(
         phEvent ///< [out][optional] returns an event object that identifies this read
                 ///< command
     ///< and can be used to query or queue a wait for this command to complete.
-    ) try {
-    auto pfnReadHostPipe = ur_lib::context->urDdiTable.Enqueue.pfnReadHostPipe;
+    ) {
+    auto pfnReadHostPipe = ur_lib::dispatchDdiTable.Enqueue.pfnReadHostPipe;
     if (nullptr == pfnReadHostPipe) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
-                           numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    }
+
+    try {
+        return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6424,17 +7309,25 @@ ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     ur_event_handle_t *
         phEvent ///< [out][optional] returns an event object that identifies this write command
     ///< and can be used to query or queue a wait for this command to complete.
-    ) try {
-    auto pfnWriteHostPipe =
-        ur_lib::context->urDdiTable.Enqueue.pfnWriteHostPipe;
+    ) {
+    auto pfnWriteHostPipe = ur_lib::dispatchDdiTable.Enqueue.pfnWriteHostPipe;
     if (nullptr == pfnWriteHostPipe) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
-                            numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
+    try {
+        return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6494,17 +7387,26 @@ ur_result_t UR_APICALL urUSMPitchedAllocExp(
         elementSizeBytes, ///< [in] size in bytes of an element in the allocation
     void **ppMem,         ///< [out] pointer to USM shared memory object
     size_t *pResultPitch  ///< [out] pitch of the allocation
-    ) try {
+    ) {
     auto pfnPitchedAllocExp =
-        ur_lib::context->urDdiTable.USMExp.pfnPitchedAllocExp;
+        ur_lib::dispatchDdiTable.USMExp.pfnPitchedAllocExp;
     if (nullptr == pfnPitchedAllocExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
-                              height, elementSizeBytes, ppMem, pResultPitch);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool,
+                                  widthInBytes, height, elementSizeBytes, ppMem,
+                                  pResultPitch);
+    }
+
+    try {
+        return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool,
+                                  widthInBytes, height, elementSizeBytes, ppMem,
+                                  pResultPitch);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6530,17 +7432,23 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
     ur_exp_image_handle_t
         hImage ///< [in] pointer to handle of image object to destroy
-    ) try {
+    ) {
     auto pfnUnsampledImageHandleDestroyExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
+        ur_lib::dispatchDdiTable.BindlessImagesExp
             .pfnUnsampledImageHandleDestroyExp;
     if (nullptr == pfnUnsampledImageHandleDestroyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
+    try {
+        return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6566,17 +7474,23 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageHandleDestroyExp(
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
     ur_exp_image_handle_t
         hImage ///< [in] pointer to handle of image object to destroy
-    ) try {
+    ) {
     auto pfnSampledImageHandleDestroyExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
+        ur_lib::dispatchDdiTable.BindlessImagesExp
             .pfnSampledImageHandleDestroyExp;
     if (nullptr == pfnSampledImageHandleDestroyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
+    try {
+        return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6613,17 +7527,24 @@ ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
     ur_exp_image_mem_handle_t
         *phImageMem ///< [out] pointer to handle of image memory allocated
-    ) try {
+    ) {
     auto pfnImageAllocateExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnImageAllocateExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnImageAllocateExp;
     if (nullptr == pfnImageAllocateExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
-                               phImageMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
+                                   phImageMem);
+    }
+
+    try {
+        return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
+                                   phImageMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6649,16 +7570,22 @@ ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
     ur_exp_image_mem_handle_t
         hImageMem ///< [in] handle of image memory to be freed
-    ) try {
+    ) {
     auto pfnImageFreeExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnImageFreeExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnImageFreeExp;
     if (nullptr == pfnImageFreeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageFreeExp(hContext, hDevice, hImageMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageFreeExp(hContext, hDevice, hImageMem);
+    }
+
+    try {
+        return pfnImageFreeExp(hContext, hDevice, hImageMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6697,18 +7624,24 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
     ur_exp_image_handle_t
         *phImage ///< [out] pointer to handle of image object created
-    ) try {
+    ) {
     auto pfnUnsampledImageCreateExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
-            .pfnUnsampledImageCreateExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnUnsampledImageCreateExp;
     if (nullptr == pfnUnsampledImageCreateExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
-                                      pImageFormat, pImageDesc, phImage);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
+                                          pImageFormat, pImageDesc, phImage);
+    }
+
+    try {
+        return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
+                                          pImageFormat, pImageDesc, phImage);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6750,17 +7683,26 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     ur_sampler_handle_t hSampler,      ///< [in] sampler to be used
     ur_exp_image_handle_t
         *phImage ///< [out] pointer to handle of image object created
-    ) try {
+    ) {
     auto pfnSampledImageCreateExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnSampledImageCreateExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnSampledImageCreateExp;
     if (nullptr == pfnSampledImageCreateExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSampledImageCreateExp(hContext, hDevice, hImageMem, pImageFormat,
-                                    pImageDesc, hSampler, phImage);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSampledImageCreateExp(hContext, hDevice, hImageMem,
+                                        pImageFormat, pImageDesc, hSampler,
+                                        phImage);
+    }
+
+    try {
+        return pfnSampledImageCreateExp(hContext, hDevice, hImageMem,
+                                        pImageFormat, pImageDesc, hSampler,
+                                        phImage);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6824,19 +7766,28 @@ ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnImageCopyExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnImageCopyExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnImageCopyExp;
     if (nullptr == pfnImageCopyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageCopyExp(hQueue, pDst, pSrc, pImageFormat, pImageDesc,
-                           imageCopyFlags, srcOffset, dstOffset, copyExtent,
-                           hostExtent, numEventsInWaitList, phEventWaitList,
-                           phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageCopyExp(hQueue, pDst, pSrc, pImageFormat, pImageDesc,
+                               imageCopyFlags, srcOffset, dstOffset, copyExtent,
+                               hostExtent, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    }
+
+    try {
+        return pfnImageCopyExp(hQueue, pDst, pSrc, pImageFormat, pImageDesc,
+                               imageCopyFlags, srcOffset, dstOffset, copyExtent,
+                               hostExtent, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6865,16 +7816,24 @@ ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     ur_image_info_t propName,            ///< [in] queried info name
     void *pPropValue,    ///< [out][optional] returned query value
     size_t *pPropSizeRet ///< [out][optional] returned query value size
-    ) try {
+    ) {
     auto pfnImageGetInfoExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnImageGetInfoExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnImageGetInfoExp;
     if (nullptr == pfnImageGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImageGetInfoExp(hImageMem, propName, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImageGetInfoExp(hImageMem, propName, pPropValue,
+                                  pPropSizeRet);
+    }
+
+    try {
+        return pfnImageGetInfoExp(hImageMem, propName, pPropValue,
+                                  pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6905,17 +7864,24 @@ ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     uint32_t mipmapLevel, ///< [in] requested level of the mipmap
     ur_exp_image_mem_handle_t
         *phImageMem ///< [out] returning memory handle to the individual image
-    ) try {
+    ) {
     auto pfnMipmapGetLevelExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnMipmapGetLevelExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnMipmapGetLevelExp;
     if (nullptr == pfnMipmapGetLevelExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
-                                phImageMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
+                                    phImageMem);
+    }
+
+    try {
+        return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
+                                    phImageMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6940,16 +7906,22 @@ ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     ur_context_handle_t hContext,  ///< [in] handle of the context object
     ur_device_handle_t hDevice,    ///< [in] handle of the device object
     ur_exp_image_mem_handle_t hMem ///< [in] handle of image memory to be freed
-    ) try {
+    ) {
     auto pfnMipmapFreeExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnMipmapFreeExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnMipmapFreeExp;
     if (nullptr == pfnMipmapFreeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMipmapFreeExp(hContext, hDevice, hMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMipmapFreeExp(hContext, hDevice, hMem);
+    }
+
+    try {
+        return pfnMipmapFreeExp(hContext, hDevice, hMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6985,18 +7957,26 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         *pInteropMemDesc, ///< [in] the interop memory descriptor
     ur_exp_interop_mem_handle_t
         *phInteropMem ///< [out] interop memory handle to the external memory
-    ) try {
+    ) {
     auto pfnImportExternalMemoryExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
-            .pfnImportExternalMemoryExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnImportExternalMemoryExp;
     if (nullptr == pfnImportExternalMemoryExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
-                                      pInteropMemDesc, phInteropMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImportExternalMemoryExp(hContext, hDevice, size,
+                                          memHandleType, pInteropMemDesc,
+                                          phInteropMem);
+    }
+
+    try {
+        return pfnImportExternalMemoryExp(hContext, hDevice, size,
+                                          memHandleType, pInteropMemDesc,
+                                          phInteropMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7032,17 +8012,24 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         hInteropMem, ///< [in] interop memory handle to the external memory
     ur_exp_image_mem_handle_t *
         phImageMem ///< [out] image memory handle to the externally allocated memory
-    ) try {
+    ) {
     auto pfnMapExternalArrayExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnMapExternalArrayExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnMapExternalArrayExp;
     if (nullptr == pfnMapExternalArrayExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat, pImageDesc,
-                                  hInteropMem, phImageMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat,
+                                      pImageDesc, hInteropMem, phImageMem);
+    }
+
+    try {
+        return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat,
+                                      pImageDesc, hInteropMem, phImageMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7068,16 +8055,22 @@ ur_result_t UR_APICALL urBindlessImagesReleaseInteropExp(
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
     ur_exp_interop_mem_handle_t
         hInteropMem ///< [in] handle of interop memory to be freed
-    ) try {
+    ) {
     auto pfnReleaseInteropExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp.pfnReleaseInteropExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnReleaseInteropExp;
     if (nullptr == pfnReleaseInteropExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReleaseInteropExp(hContext, hDevice, hInteropMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReleaseInteropExp(hContext, hDevice, hInteropMem);
+    }
+
+    try {
+        return pfnReleaseInteropExp(hContext, hDevice, hInteropMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7111,19 +8104,27 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         *pInteropSemaphoreDesc, ///< [in] the interop semaphore descriptor
     ur_exp_interop_semaphore_handle_t *
         phInteropSemaphore ///< [out] interop semaphore handle to the external semaphore
-    ) try {
+    ) {
     auto pfnImportExternalSemaphoreExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
+        ur_lib::dispatchDdiTable.BindlessImagesExp
             .pfnImportExternalSemaphoreExp;
     if (nullptr == pfnImportExternalSemaphoreExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
-                                         pInteropSemaphoreDesc,
-                                         phInteropSemaphore);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
+                                             pInteropSemaphoreDesc,
+                                             phInteropSemaphore);
+    }
+
+    try {
+        return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
+                                             pInteropSemaphoreDesc,
+                                             phInteropSemaphore);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7149,17 +8150,25 @@ ur_result_t UR_APICALL urBindlessImagesDestroyExternalSemaphoreExp(
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
     ur_exp_interop_semaphore_handle_t
         hInteropSemaphore ///< [in] handle of interop semaphore to be destroyed
-    ) try {
+    ) {
     auto pfnDestroyExternalSemaphoreExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
+        ur_lib::dispatchDdiTable.BindlessImagesExp
             .pfnDestroyExternalSemaphoreExp;
     if (nullptr == pfnDestroyExternalSemaphoreExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnDestroyExternalSemaphoreExp(hContext, hDevice, hInteropSemaphore);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnDestroyExternalSemaphoreExp(hContext, hDevice,
+                                              hInteropSemaphore);
+    }
+
+    try {
+        return pfnDestroyExternalSemaphoreExp(hContext, hDevice,
+                                              hInteropSemaphore);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7199,19 +8208,26 @@ ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnWaitExternalSemaphoreExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
-            .pfnWaitExternalSemaphoreExp;
+        ur_lib::dispatchDdiTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
     if (nullptr == pfnWaitExternalSemaphoreExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
-                                       waitValue, numEventsInWaitList,
-                                       phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
+                                           waitValue, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
+                                           waitValue, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7252,19 +8268,27 @@ ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
-    ) try {
+    ) {
     auto pfnSignalExternalSemaphoreExp =
-        ur_lib::context->urDdiTable.BindlessImagesExp
+        ur_lib::dispatchDdiTable.BindlessImagesExp
             .pfnSignalExternalSemaphoreExp;
     if (nullptr == pfnSignalExternalSemaphoreExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
-                                         signalValue, numEventsInWaitList,
-                                         phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
+                                             signalValue, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
+                                             signalValue, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7296,16 +8320,23 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
         *pCommandBufferDesc, ///< [in][optional] command-buffer descriptor.
     ur_exp_command_buffer_handle_t
         *phCommandBuffer ///< [out] Pointer to command-Buffer handle.
-    ) try {
-    auto pfnCreateExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnCreateExp;
+    ) {
+    auto pfnCreateExp = ur_lib::dispatchDdiTable.CommandBufferExp.pfnCreateExp;
     if (nullptr == pfnCreateExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCreateExp(hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCreateExp(hContext, hDevice, pCommandBufferDesc,
+                            phCommandBuffer);
+    }
+
+    try {
+        return pfnCreateExp(hContext, hDevice, pCommandBufferDesc,
+                            phCommandBuffer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7324,16 +8355,21 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
 ur_result_t UR_APICALL urCommandBufferRetainExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in] Handle of the command-buffer object.
-    ) try {
-    auto pfnRetainExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnRetainExp;
+    ) {
+    auto pfnRetainExp = ur_lib::dispatchDdiTable.CommandBufferExp.pfnRetainExp;
     if (nullptr == pfnRetainExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetainExp(hCommandBuffer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetainExp(hCommandBuffer);
+    }
+
+    try {
+        return pfnRetainExp(hCommandBuffer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7353,16 +8389,22 @@ ur_result_t UR_APICALL urCommandBufferRetainExp(
 ur_result_t UR_APICALL urCommandBufferReleaseExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in] Handle of the command-buffer object.
-    ) try {
+    ) {
     auto pfnReleaseExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnReleaseExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReleaseExp(hCommandBuffer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReleaseExp(hCommandBuffer);
+    }
+
+    try {
+        return pfnReleaseExp(hCommandBuffer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7382,16 +8424,22 @@ ur_result_t UR_APICALL urCommandBufferReleaseExp(
 ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in] Handle of the command-buffer object.
-    ) try {
+    ) {
     auto pfnFinalizeExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnFinalizeExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnFinalizeExp;
     if (nullptr == pfnFinalizeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnFinalizeExp(hCommandBuffer);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnFinalizeExp(hCommandBuffer);
+    }
+
+    try {
+        return pfnFinalizeExp(hCommandBuffer);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7439,19 +8487,28 @@ ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         pSyncPoint, ///< [out][optional] Sync point associated with this command.
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
-    ) try {
+    ) {
     auto pfnAppendKernelLaunchExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp;
     if (nullptr == pfnAppendKernelLaunchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendKernelLaunchExp(hCommandBuffer, hKernel, workDim,
-                                    pGlobalWorkOffset, pGlobalWorkSize,
-                                    pLocalWorkSize, numSyncPointsInWaitList,
-                                    pSyncPointWaitList, pSyncPoint, phCommand);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendKernelLaunchExp(
+            hCommandBuffer, hKernel, workDim, pGlobalWorkOffset,
+            pGlobalWorkSize, pLocalWorkSize, numSyncPointsInWaitList,
+            pSyncPointWaitList, pSyncPoint, phCommand);
+    }
+
+    try {
+        return pfnAppendKernelLaunchExp(
+            hCommandBuffer, hKernel, workDim, pGlobalWorkOffset,
+            pGlobalWorkSize, pLocalWorkSize, numSyncPointsInWaitList,
+            pSyncPointWaitList, pSyncPoint, phCommand);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7491,18 +8548,26 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendUSMMemcpyExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp;
     if (nullptr == pfnAppendUSMMemcpyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
-                                 numSyncPointsInWaitList, pSyncPointWaitList,
-                                 pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7547,18 +8612,26 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendUSMFillExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendUSMFillExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendUSMFillExp;
     if (nullptr == pfnAppendUSMFillExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern, patternSize,
-                               size, numSyncPointsInWaitList,
-                               pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern,
+                                   patternSize, size, numSyncPointsInWaitList,
+                                   pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern,
+                                   patternSize, size, numSyncPointsInWaitList,
+                                   pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7596,18 +8669,26 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferCopyExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp;
     if (nullptr == pfnAppendMemBufferCopyExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferCopyExp(
-        hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
-        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferCopyExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferCopyExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7646,18 +8727,26 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferWriteExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferWriteExp;
     if (nullptr == pfnAppendMemBufferWriteExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
-                                      pSrc, numSyncPointsInWaitList,
-                                      pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
+                                          pSrc, numSyncPointsInWaitList,
+                                          pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
+                                          pSrc, numSyncPointsInWaitList,
+                                          pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7695,18 +8784,26 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferReadExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferReadExp;
     if (nullptr == pfnAppendMemBufferReadExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
-                                     pDst, numSyncPointsInWaitList,
-                                     pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
+                                         pDst, numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
+                                         pDst, numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7751,20 +8848,28 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferCopyRectExp =
-        ur_lib::context->urDdiTable.CommandBufferExp
-            .pfnAppendMemBufferCopyRectExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferCopyRectExp;
     if (nullptr == pfnAppendMemBufferCopyRectExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferCopyRectExp(
-        hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
-        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
-        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferCopyRectExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+            srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferCopyRectExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+            srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7816,20 +8921,29 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferWriteRectExp =
-        ur_lib::context->urDdiTable.CommandBufferExp
+        ur_lib::dispatchDdiTable.CommandBufferExp
             .pfnAppendMemBufferWriteRectExp;
     if (nullptr == pfnAppendMemBufferWriteRectExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferWriteRectExp(
-        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferWriteRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pSrc, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferWriteRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pSrc, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7879,20 +8993,28 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferReadRectExp =
-        ur_lib::context->urDdiTable.CommandBufferExp
-            .pfnAppendMemBufferReadRectExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferReadRectExp;
     if (nullptr == pfnAppendMemBufferReadRectExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferReadRectExp(
-        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferReadRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pDst, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferReadRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pDst, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7934,18 +9056,26 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendMemBufferFillExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp;
     if (nullptr == pfnAppendMemBufferFillExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendMemBufferFillExp(
-        hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
-        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendMemBufferFillExp(
+            hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendMemBufferFillExp(
+            hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7991,18 +9121,26 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendUSMPrefetchExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendUSMPrefetchExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendUSMPrefetchExp;
     if (nullptr == pfnAppendUSMPrefetchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
-                                   numSyncPointsInWaitList, pSyncPointWaitList,
-                                   pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
+                                       numSyncPointsInWaitList,
+                                       pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
+                                       numSyncPointsInWaitList,
+                                       pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8048,18 +9186,26 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
                             ///< be ignored if command-buffer is in-order.
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
-    ) try {
+    ) {
     auto pfnAppendUSMAdviseExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnAppendUSMAdviseExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnAppendUSMAdviseExp;
     if (nullptr == pfnAppendUSMAdviseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
-                                 numSyncPointsInWaitList, pSyncPointWaitList,
-                                 pSyncPoint);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
+    try {
+        return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8095,17 +9241,24 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command-buffer execution instance.
-    ) try {
+    ) {
     auto pfnEnqueueExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnEnqueueExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnEnqueueExp;
     if (nullptr == pfnEnqueueExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
-                         phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8124,16 +9277,22 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
 ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in] Handle of the command-buffer command.
-    ) try {
+    ) {
     auto pfnRetainCommandExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnRetainCommandExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnRetainCommandExp;
     if (nullptr == pfnRetainCommandExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnRetainCommandExp(hCommand);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnRetainCommandExp(hCommand);
+    }
+
+    try {
+        return pfnRetainCommandExp(hCommand);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8153,16 +9312,22 @@ ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
 ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in] Handle of the command-buffer command.
-    ) try {
+    ) {
     auto pfnReleaseCommandExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnReleaseCommandExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnReleaseCommandExp;
     if (nullptr == pfnReleaseCommandExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReleaseCommandExp(hCommand);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReleaseCommandExp(hCommand);
+    }
+
+    try {
+        return pfnReleaseCommandExp(hCommand);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8203,16 +9368,22 @@ ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         hCommand, ///< [in] Handle of the command-buffer kernel command to update.
     const ur_exp_command_buffer_update_kernel_launch_desc_t *
         pUpdateKernelLaunch ///< [in] Struct defining how the kernel command is to be updated.
-    ) try {
+    ) {
     auto pfnUpdateKernelLaunchExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnUpdateKernelLaunchExp;
     if (nullptr == pfnUpdateKernelLaunchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+    }
+
+    try {
+        return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8250,17 +9421,24 @@ ur_result_t UR_APICALL urCommandBufferGetInfoExp(
                     ///< command-buffer property
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer property
-    ) try {
+    ) {
     auto pfnGetInfoExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnGetInfoExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnGetInfoExp;
     if (nullptr == pfnGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
-                         pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
+                             pPropSizeRet);
+    }
+
+    try {
+        return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
+                             pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8298,17 +9476,24 @@ ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
                     ///< command-buffer command property
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer command property
-    ) try {
+    ) {
     auto pfnCommandGetInfoExp =
-        ur_lib::context->urDdiTable.CommandBufferExp.pfnCommandGetInfoExp;
+        ur_lib::dispatchDdiTable.CommandBufferExp.pfnCommandGetInfoExp;
     if (nullptr == pfnCommandGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
-                                pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
+                                    pPropSizeRet);
+    }
+
+    try {
+        return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
+                                    pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8365,18 +9550,26 @@ ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
+    ) {
     auto pfnCooperativeKernelLaunchExp =
-        ur_lib::context->urDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
+        ur_lib::dispatchDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
     if (nullptr == pfnCooperativeKernelLaunchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCooperativeKernelLaunchExp(
-        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
-        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCooperativeKernelLaunchExp(
+            hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+            pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnCooperativeKernelLaunchExp(
+            hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+            pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8401,18 +9594,25 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         dynamicSharedMemorySize, ///< [in] size of dynamic shared memory, for each work-group, in bytes,
     ///< that will be used when the kernel is launched
     uint32_t *pGroupCountRet ///< [out] pointer to maximum number of groups
-    ) try {
+    ) {
     auto pfnSuggestMaxCooperativeGroupCountExp =
-        ur_lib::context->urDdiTable.KernelExp
+        ur_lib::dispatchDdiTable.KernelExp
             .pfnSuggestMaxCooperativeGroupCountExp;
     if (nullptr == pfnSuggestMaxCooperativeGroupCountExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnSuggestMaxCooperativeGroupCountExp(
-        hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnSuggestMaxCooperativeGroupCountExp(
+            hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+    }
+
+    try {
+        return pfnSuggestMaxCooperativeGroupCountExp(
+            hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8450,17 +9650,24 @@ ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ///< reports the timestamp at the time of the call to this function.
     ///< Querying `UR_PROFILING_INFO_COMMAND_START` or `UR_PROFILING_INFO_COMMAND_END`
     ///< reports the timestamp recorded when the command is executed on the device.
-    ) try {
+    ) {
     auto pfnTimestampRecordingExp =
-        ur_lib::context->urDdiTable.EnqueueExp.pfnTimestampRecordingExp;
+        ur_lib::dispatchDdiTable.EnqueueExp.pfnTimestampRecordingExp;
     if (nullptr == pfnTimestampRecordingExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
-                                    phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8537,19 +9744,28 @@ ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
-    ) try {
+    ) {
     auto pfnKernelLaunchCustomExp =
-        ur_lib::context->urDdiTable.EnqueueExp.pfnKernelLaunchCustomExp;
+        ur_lib::dispatchDdiTable.EnqueueExp.pfnKernelLaunchCustomExp;
     if (nullptr == pfnKernelLaunchCustomExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnKernelLaunchCustomExp(hQueue, hKernel, workDim, pGlobalWorkSize,
-                                    pLocalWorkSize, numPropsInLaunchPropList,
-                                    launchPropList, numEventsInWaitList,
-                                    phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnKernelLaunchCustomExp(
+            hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+            numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+            phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnKernelLaunchCustomExp(
+            hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+            numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+            phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8586,15 +9802,21 @@ ur_result_t UR_APICALL urProgramBuildExp(
         phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
-    ) try {
-    auto pfnBuildExp = ur_lib::context->urDdiTable.ProgramExp.pfnBuildExp;
+    ) {
+    auto pfnBuildExp = ur_lib::dispatchDdiTable.ProgramExp.pfnBuildExp;
     if (nullptr == pfnBuildExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
+    try {
+        return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8631,15 +9853,21 @@ ur_result_t UR_APICALL urProgramCompileExp(
         phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
-    ) try {
-    auto pfnCompileExp = ur_lib::context->urDdiTable.ProgramExp.pfnCompileExp;
+    ) {
+    auto pfnCompileExp = ur_lib::dispatchDdiTable.ProgramExp.pfnCompileExp;
     if (nullptr == pfnCompileExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
+    try {
+        return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8685,16 +9913,23 @@ ur_result_t UR_APICALL urProgramLinkExp(
         pOptions, ///< [in][optional] pointer to linker options null-terminated string.
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of program object created.
-    ) try {
-    auto pfnLinkExp = ur_lib::context->urDdiTable.ProgramExp.pfnLinkExp;
+    ) {
+    auto pfnLinkExp = ur_lib::dispatchDdiTable.ProgramExp.pfnLinkExp;
     if (nullptr == pfnLinkExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
-                      pOptions, phProgram);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
+                          pOptions, phProgram);
+    }
+
+    try {
+        return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
+                          pOptions, phProgram);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8718,15 +9953,21 @@ ur_result_t UR_APICALL urUSMImportExp(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem,                   ///< [in] pointer to host memory object
     size_t size ///< [in] size in bytes of the host memory object to be imported
-    ) try {
-    auto pfnImportExp = ur_lib::context->urDdiTable.USMExp.pfnImportExp;
+    ) {
+    auto pfnImportExp = ur_lib::dispatchDdiTable.USMExp.pfnImportExp;
     if (nullptr == pfnImportExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnImportExp(hContext, pMem, size);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnImportExp(hContext, pMem, size);
+    }
+
+    try {
+        return pfnImportExp(hContext, pMem, size);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8748,15 +9989,21 @@ ur_result_t UR_APICALL urUSMImportExp(
 ur_result_t UR_APICALL urUSMReleaseExp(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to host memory object
-    ) try {
-    auto pfnReleaseExp = ur_lib::context->urDdiTable.USMExp.pfnReleaseExp;
+    ) {
+    auto pfnReleaseExp = ur_lib::dispatchDdiTable.USMExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnReleaseExp(hContext, pMem);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnReleaseExp(hContext, pMem);
+    }
+
+    try {
+        return pfnReleaseExp(hContext, pMem);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8798,16 +10045,22 @@ ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     ur_device_handle_t
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
-    ) try {
+    ) {
     auto pfnEnablePeerAccessExp =
-        ur_lib::context->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+        ur_lib::dispatchDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
     if (nullptr == pfnEnablePeerAccessExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnEnablePeerAccessExp(commandDevice, peerDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    }
+
+    try {
+        return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8850,16 +10103,22 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     ur_device_handle_t
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
-    ) try {
+    ) {
     auto pfnDisablePeerAccessExp =
-        ur_lib::context->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+        ur_lib::dispatchDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
     if (nullptr == pfnDisablePeerAccessExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnDisablePeerAccessExp(commandDevice, peerDevice);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    }
+
+    try {
+        return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8908,17 +10167,24 @@ ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     ///< pPropValue is not used.
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
-    ) try {
+    ) {
     auto pfnPeerAccessGetInfoExp =
-        ur_lib::context->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+        ur_lib::dispatchDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
     if (nullptr == pfnPeerAccessGetInfoExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
-                                   propSize, pPropValue, pPropSizeRet);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                       propSize, pPropValue, pPropSizeRet);
+    }
+
+    try {
+        return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                       propSize, pPropValue, pPropSizeRet);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8959,18 +10225,26 @@ ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     ur_event_handle_t *
         phEvent ///< [in,out] return an event object that identifies the work that has
                 ///< been enqueued in nativeEnqueueFunc.
-    ) try {
+    ) {
     auto pfnNativeCommandExp =
-        ur_lib::context->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+        ur_lib::dispatchDdiTable.EnqueueExp.pfnNativeCommandExp;
     if (nullptr == pfnNativeCommandExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data, numMemsInMemList,
-                               phMemList, pProperties, numEventsInWaitList,
-                               phEventWaitList, phEvent);
-} catch (...) {
-    return exceptionToResult(std::current_exception());
+    if (ur_lib::directDispatch) {
+        return pfnNativeCommandExp(
+            hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+            pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    try {
+        return pfnNativeCommandExp(
+            hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+            pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+    } catch (...) {
+        return exceptionToResult(std::current_exception());
+    }
 }
 
 } // extern "C"
@@ -9,12 +9,73 @@
  */
 #include "ur_loader.hpp"
 
+#include <algorithm>
+#include <cctype>
+
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *context;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Whether ONEAPI_DEVICE_SELECTOR can select any device of the adapter
+///        at path, so that adapters it rules out needn't be loaded. As in
+///        urDeviceGetSelected, adapters without a named backend only match
+///        "*", and if there are no accept terms every backend is accepted.
+static bool isAdapterSelected(const fs::path &path,
+                              const std::optional<EnvVarMap> &selector) {
+    if (!selector.has_value()) {
+        return true;
+    }
+
+    std::string backend = "*";
+    const auto name = path.filename().string();
+    for (const char *knownBackend : {"level_zero", "opencl", "cuda", "hip"}) {
+        if (name.find(std::string("ur_adapter_") + knownBackend) !=
+            std::string::npos) {
+            backend = knownBackend;
+            break;
+        }
+    }
+
+    auto matches = [&backend](std::string term) {
+        std::transform(term.begin(), term.end(), term.begin(), ::tolower);
+        return term == "*" || term == backend;
+    };
+
+    bool hasAcceptTerms = false;
+    bool accepted = false;
+    for (const auto &[term, filters] : selector.value()) {
+        // Left by empty terms such as in "level_zero:0;;"
+        if (term.empty()) {
+            continue;
+        }
+        if (term.front() == '!') {
+            // Discarding all root devices of a backend rules it out
+            if (matches(term.substr(1)) &&
+                std::find(filters.begin(), filters.end(), "*") !=
+                    filters.end()) {
+                return false;
+            }
+        } else {
+            hasAcceptTerms = true;
+            accepted = accepted || matches(term);
+        }
+    }
+    return !hasAcceptTerms || accepted;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ur_result_t context_t::init() {
+    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
+    lazyLoad = getenv_tobool("UR_ADAPTERS_LAZY_LOAD");
+
+    if (lazyLoad) {
+        // How many adapters there are isn't known until they're loaded, so
+        // calls have to go through the loader
+        intercept_enabled = true;
+        return UR_RESULT_SUCCESS;
+    }
+
     for (const auto &adapterPaths : adapter_registry) {
         for (const auto &path : adapterPaths) {
             auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
@@ -25,8 +86,6 @@ ur_result_t context_t::init() {
         }
     }
 
-    forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
-
     if (forceIntercept || platforms.size() > 1) {
         intercept_enabled = true;
     }
@@ -34,4 +93,38 @@ ur_result_t context_t::init() {
     return UR_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void context_t::loadLazyAdapters() {
+    if (!lazyLoad) {
+        return;
+    }
+
+    std::call_once(lazyLoadOnce, [this]() {
+        std::optional<EnvVarMap> selector;
+        try {
+            selector = getenv_to_map("ONEAPI_DEVICE_SELECTOR", false);
+        } catch (const std::invalid_argument &e) {
+            logger::error(e.what());
+        }
+
+        for (const auto &adapterPaths : adapter_registry) {
+            for (const auto &path : adapterPaths) {
+                if (!isAdapterSelected(path, selector)) {
+                    logger::debug("Not loading {}, it isn't selected by "
+                                  "ONEAPI_DEVICE_SELECTOR",
+                                  path.string());
+                    break;
+                }
+                auto handle =
+                    LibLoader::loadAdapterLibrary(path.string().c_str());
+                if (handle) {
+                    platforms.emplace_back(std::move(handle));
+                    loadDdiTables(platforms.back());
+                    break;
+                }
+            }
+        }
+    });
+}
+
 } // namespace ur_loader
@@ -15,6 +15,8 @@
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
 
+#include <mutex>
+
 namespace ur_loader {
 
 struct platform_t {
@@ -28,6 +30,9 @@ struct platform_t {
 
 using platform_vector_t = std::vector<platform_t>;
 
+/// Fills the DDI tables of an adapter loaded after urLoaderInit
+void loadDdiTables(platform_t &platform);
+
 class context_t {
   public:
     ur_api_version_t version = UR_API_VERSION_CURRENT;
@@ -37,7 +42,13 @@ class context_t {
 
     bool forceIntercept = false;
 
+    /// Set by UR_ADAPTERS_LAZY_LOAD, adapters are then loaded by the first
+    /// urAdapterGet rather than by init()
+    bool lazyLoad = false;
+    std::once_flag lazyLoadOnce;
+
     ur_result_t init();
+    void loadLazyAdapters();
     bool intercept_enabled = false;
 };
 
@@ -16,6 +16,10 @@
 #include "ur_ddi.h"
 #include "ur_util.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 //////////////////////////////////////////////////////////////////////////
 struct dditable_t {
     ur_dditable_t ur;
@@ -39,4 +43,69 @@ template <typename _handle_t> class __urdlllocal object_t {
     ~object_t() = default;
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// a list of adapter handles converted from loader handles for one call
+///
+/// short lists are held inline and long ones in a buffer owned by the
+/// thread, so that converting a list doesn't allocate on every call, and
+/// an empty list doesn't touch either
+template <typename _handle_t> class __urdlllocal handle_list_t {
+  public:
+    using handle_t = _handle_t;
+
+    static constexpr size_t inlineSize = 16; ///< handles held inline
+
+    explicit handle_list_t(size_t _size) : size(_size) {
+        if (size <= inlineSize) {
+            handles = inlineHandles;
+            return;
+        }
+
+        auto &scratch = getScratch();
+        if (!scratch.inUse) {
+            // a call converting several lists only has one scratch buffer
+            if (scratch.handles.size() < size) {
+                scratch.handles.resize(size);
+            }
+            scratch.inUse = true;
+            ownsScratch = true;
+            handles = scratch.handles.data();
+        } else {
+            heapHandles = std::make_unique<handle_t[]>(size);
+            handles = heapHandles.get();
+        }
+    }
+
+    handle_list_t(const handle_list_t &) = delete;
+    handle_list_t &operator=(const handle_list_t &) = delete;
+
+    ~handle_list_t() {
+        if (ownsScratch) {
+            getScratch().inUse = false;
+        }
+    }
+
+    handle_t &operator[](size_t index) { return handles[index]; }
+
+    /// nullptr for an empty list, like an empty vector's data
+    handle_t *data() { return size ? handles : nullptr; }
+
+  private:
+    struct scratch_t {
+        std::vector<handle_t> handles;
+        bool inUse = false;
+    };
+
+    static scratch_t &getScratch() {
+        static thread_local scratch_t scratch;
+        return scratch;
+    }
+
+    size_t size;
+    handle_t *handles = nullptr;
+    bool ownsScratch = false;
+    std::unique_ptr<handle_t[]> heapHandles;
+    handle_t inlineHandles[inlineSize];
+};
+
 #endif /* UR_OBJECT_H */
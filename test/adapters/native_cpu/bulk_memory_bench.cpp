@@ -0,0 +1,96 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the bandwidth of the fill and copy engine used by the memory
+// commands against a plain memset and memcpy on the calling thread, and
+// against the previous fill, which stored one pattern at a time.
+
+#include "bulk_memory.hpp"
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+void runParallel(native_cpu::threadpool_t &tp, size_t size, size_t granule,
+                 std::function<void(size_t, size_t)> op) {
+    std::atomic<bool> done{false};
+    native_cpu::bulk::parallelRanges(
+        tp, size, granule, std::move(op),
+        [&done]() { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+template <typename OpT> double gbPerSecond(size_t size, OpT op) {
+    op();
+    const size_t reps = std::max<size_t>(3, (size_t{1} << 30) / size);
+    auto start = clock_type::now();
+    for (size_t i = 0; i < reps; i++) {
+        op();
+    }
+    auto end = clock_type::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(size) * static_cast<double>(reps) / seconds /
+           1e9;
+}
+
+} // namespace
+
+int main() {
+    native_cpu::threadpool_t tp;
+    std::printf("threads=%zu\n", tp.num_threads());
+    std::printf("%12s %10s %10s %10s %10s %10s\n", "bytes", "memset",
+                "loop fill", "fill", "memcpy", "copy");
+    const uint32_t pattern = 0x01020304;
+    for (size_t size :
+         {size_t{1} << 16, size_t{1} << 20, size_t{1} << 24, size_t{1} << 28}) {
+        std::vector<uint8_t> src(size, 1), dst(size);
+        const bool nonTemporal =
+            size >= native_cpu::bulk::nonTemporalThreshold;
+
+        double memsetRate =
+            gbPerSecond(size, [&]() { memset(dst.data(), 7, size); });
+        double loopRate = gbPerSecond(size, [&]() {
+            for (size_t i = 0; i < size / sizeof(pattern); i++) {
+                memcpy(dst.data() + i * sizeof(pattern), &pattern,
+                       sizeof(pattern));
+            }
+        });
+        double fillRate = gbPerSecond(size, [&]() {
+            runParallel(tp, size, native_cpu::bulk::fillGranule(4),
+                        [&](size_t begin, size_t end) {
+                            native_cpu::bulk::fill(dst.data() + begin,
+                                                   &pattern, sizeof(pattern),
+                                                   end - begin, nonTemporal);
+                        });
+        });
+        double memcpyRate = gbPerSecond(
+            size, [&]() { memcpy(dst.data(), src.data(), size); });
+        double copyRate = gbPerSecond(size, [&]() {
+            runParallel(tp, size, native_cpu::bulk::chunkSize,
+                        [&](size_t begin, size_t end) {
+                            native_cpu::bulk::copy(dst.data() + begin,
+                                                   src.data() + begin,
+                                                   end - begin, nonTemporal);
+                        });
+        });
+        std::printf("%12zu %10.2f %10.2f %10.2f %10.2f %10.2f\n", size,
+                    memsetRate, loopRate, fillRate, memcpyRate, copyRate);
+    }
+    std::printf("(GB/s)\n");
+    return 0;
+}
@@ -0,0 +1,283 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "bulk_memory.hpp"
+#include "threadpool.hpp"
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+std::vector<uint8_t> makePattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    std::iota(pattern.begin(), pattern.end(), uint8_t{1});
+    return pattern;
+}
+
+void expectPattern(const uint8_t *data, size_t size,
+                   const std::vector<uint8_t> &pattern) {
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(data[i], pattern[i % pattern.size()]) << "index " << i;
+    }
+}
+} // namespace
+
+TEST(BulkMemoryTest, FillPatternsAndAlignments) {
+    std::vector<uint8_t> buffer(4096 + 256);
+    for (size_t patternSize : {1, 2, 3, 4, 8, 16, 24, 64, 128}) {
+        const auto pattern = makePattern(patternSize);
+        for (size_t offset : {0, 1, 7, 16, 63}) {
+            for (bool nonTemporal : {false, true}) {
+                const size_t size = 4096 / patternSize * patternSize;
+                std::fill(buffer.begin(), buffer.end(), uint8_t{0});
+                native_cpu::bulk::fill(buffer.data() + offset, pattern.data(),
+                                       patternSize, size, nonTemporal);
+                expectPattern(buffer.data() + offset, size, pattern);
+                // Nothing is written past the end
+                for (size_t i = offset + size; i < buffer.size(); i++) {
+                    ASSERT_EQ(buffer[i], 0) << "index " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(BulkMemoryTest, FillPhase) {
+    std::vector<uint8_t> buffer(1024);
+    for (size_t patternSize : {4, 24, 128}) {
+        const auto pattern = makePattern(patternSize);
+        for (size_t phase : {size_t{1}, patternSize - 1}) {
+            native_cpu::bulk::fill(buffer.data(), pattern.data(), patternSize,
+                                   buffer.size(), false, phase);
+            for (size_t i = 0; i < buffer.size(); i++) {
+                ASSERT_EQ(buffer[i], pattern[(phase + i) % patternSize])
+                    << "index " << i;
+            }
+        }
+    }
+}
+
+TEST(BulkMemoryTest, CopyAlignments) {
+    std::vector<uint8_t> src(8192), dst(8192 + 64);
+    std::iota(src.begin(), src.end(), uint8_t{0});
+    for (size_t offset : {0, 3, 16}) {
+        for (size_t size : {0, 1, 255, 256, 1000, 8192}) {
+            for (bool nonTemporal : {false, true}) {
+                std::fill(dst.begin(), dst.end(), uint8_t{0xff});
+                native_cpu::bulk::copy(dst.data() + offset, src.data(), size,
+                                       nonTemporal);
+                for (size_t i = 0; i < size; i++) {
+                    ASSERT_EQ(dst[offset + i], src[i]) << "index " << i;
+                }
+                ASSERT_EQ(dst[offset + size], 0xff);
+            }
+        }
+    }
+}
+
+TEST(BulkMemoryTest, CollapseStridedRegion) {
+    using region_t = native_cpu::bulk::strided_region_t;
+    // Contiguous rows and slices become a single row
+    region_t region{16, 4, 2, 16, 64, 16, 64};
+    region.collapse();
+    EXPECT_EQ(region.rowSize, 128u);
+    EXPECT_EQ(region.numTotalRows(), 1u);
+
+    // Contiguous rows but padded slices become one row per slice
+    region = {16, 4, 2, 16, 80, 16, 64};
+    region.collapse();
+    EXPECT_EQ(region.rowSize, 64u);
+    EXPECT_EQ(region.numTotalRows(), 2u);
+    EXPECT_EQ(region.dstOffset(1), 80u);
+    EXPECT_EQ(region.srcOffset(1), 64u);
+
+    // Single rows are laid out by the slice pitches
+    region = {16, 1, 3, 32, 16, 32, 16};
+    region.collapse();
+    EXPECT_EQ(region.rowSize, 48u);
+    EXPECT_EQ(region.numTotalRows(), 1u);
+
+    // Padded rows stay apart
+    region = {16, 4, 2, 17, 68, 16, 64};
+    region.collapse();
+    EXPECT_EQ(region.rowSize, 16u);
+    EXPECT_EQ(region.numTotalRows(), 8u);
+    EXPECT_EQ(region.dstOffset(5), 68u + 17u);
+    EXPECT_EQ(region.srcOffset(5), 64u + 16u);
+}
+
+namespace {
+// Thread pool whose workers pretend to be spread over two NUMA nodes.
+struct two_node_pool_t : native_cpu::detail::simple_thread_pool {
+    const native_cpu::worker_placement_t &placement() const noexcept {
+        return twoNodes;
+    }
+    native_cpu::worker_placement_t twoNodes{{{0, {0}}, {1, {1}}},
+                                            num_threads()};
+};
+} // namespace
+
+TEST(BulkMemoryTest, FirstTouch) {
+    two_node_pool_t pool;
+    if (pool.placement().num_nodes() < 2) {
+        GTEST_SKIP() << "needs at least two workers";
+    }
+    const size_t size = 4 * native_cpu::bulk::parallelThreshold;
+    constexpr size_t pageSize = native_cpu::bulk::pageSize;
+    std::vector<uint8_t> buffer(size + 3 * pageSize, 0xff);
+    // Start and end in the middle of a page
+    const size_t pageOffset =
+        pageSize - reinterpret_cast<uintptr_t>(buffer.data()) % pageSize;
+    uint8_t *ptr = buffer.data() + pageOffset + pageSize / 2;
+    native_cpu::bulk::firstTouch(pool, ptr, size);
+    size_t numTouched = 0;
+    for (size_t i = 0; i < buffer.size(); i++) {
+        const uint8_t *byte = &buffer[i];
+        const bool pageStart =
+            reinterpret_cast<uintptr_t>(byte) % pageSize == 0;
+        const bool inside = byte >= ptr && byte + pageSize <= ptr + size;
+        if (pageStart && inside) {
+            ASSERT_EQ(buffer[i], 0) << "index " << i;
+            numTouched++;
+        } else {
+            ASSERT_EQ(buffer[i], 0xff) << "index " << i;
+        }
+    }
+    EXPECT_EQ(numTouched, size / pageSize - 1);
+}
+
+using urNativeCpuBulkMemoryTest = uur::urQueueTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuBulkMemoryTest);
+
+TEST_P(urNativeCpuBulkMemoryTest, LargeFillAndCopy) {
+    // Large enough to be split across the thread pool and to use
+    // non-temporal stores, and a multiple of both pattern sizes.
+    const size_t size = (native_cpu::bulk::nonTemporalThreshold / 12 + 1) * 12;
+    void *src = nullptr, *dst = nullptr;
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, nullptr, size, &src));
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, nullptr, size, &dst));
+
+    for (size_t patternSize : {4, 12}) {
+        const auto pattern = makePattern(patternSize);
+        ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, patternSize,
+                                        pattern.data(), size, 0, nullptr,
+                                        nullptr));
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, dst, src, size, 0,
+                                          nullptr, nullptr));
+        expectPattern(static_cast<uint8_t *>(dst), size, pattern);
+    }
+
+    ASSERT_SUCCESS(urUSMFree(context, src));
+    ASSERT_SUCCESS(urUSMFree(context, dst));
+}
+
+TEST_P(urNativeCpuBulkMemoryTest, LargeRectCopy) {
+    // Rows of a few KiB in padded slices, so that rows are grouped into
+    // pieces that run in parallel.
+    constexpr size_t width = 3000, height = 100, depth = 6;
+    constexpr size_t srcRowPitch = width, srcSlicePitch = width * height;
+    constexpr size_t dstRowPitch = width + 40,
+                     dstSlicePitch = dstRowPitch * height + 8;
+    std::vector<uint8_t> src(srcSlicePitch * depth);
+    std::iota(src.begin(), src.end(), uint8_t{0});
+    std::vector<uint8_t> dst(dstSlicePitch * depth, 0xff);
+
+    ur_mem_handle_t buffer = nullptr;
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                     src.size(), nullptr, &buffer));
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, true, 0, src.size(),
+                                           src.data(), 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueMemBufferReadRect(
+        queue, buffer, true, {0, 0, 0}, {0, 0, 0}, {width, height, depth},
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch, dst.data(), 0,
+        nullptr, nullptr));
+    ASSERT_SUCCESS(urMemRelease(buffer));
+
+    for (size_t z = 0; z < depth; z++) {
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < dstRowPitch; x++) {
+                const uint8_t value =
+                    dst[z * dstSlicePitch + y * dstRowPitch + x];
+                if (x < width) {
+                    ASSERT_EQ(value,
+                              src[z * srcSlicePitch + y * srcRowPitch + x]);
+                } else {
+                    ASSERT_EQ(value, 0xff);
+                }
+            }
+        }
+    }
+}
+
+TEST_P(urNativeCpuBulkMemoryTest, LargeFill2D) {
+    // Rows larger than a piece, so that they're split, and a pattern that
+    // doesn't start over at the start of each row.
+    constexpr size_t width = 300 * 1024 + 4, height = 6, pitch = width + 60;
+    constexpr size_t patternSize = 8;
+    const auto pattern = makePattern(patternSize);
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                    pitch * height, &ptr));
+    auto *bytes = static_cast<uint8_t *>(ptr);
+    std::fill_n(bytes, pitch * height, uint8_t{0});
+
+    ASSERT_SUCCESS(urEnqueueUSMFill2D(queue, ptr, pitch, patternSize,
+                                      pattern.data(), width, height, 0,
+                                      nullptr, nullptr));
+    std::vector<uint8_t> copy(width * height);
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy2D(queue, true, copy.data(), width, ptr,
+                                        pitch, width, height, 0, nullptr,
+                                        nullptr));
+    expectPattern(copy.data(), copy.size(), pattern);
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = width; x < pitch; x++) {
+            ASSERT_EQ(bytes[y * pitch + x], 0) << "row " << y;
+        }
+    }
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+}
+
+TEST_P(urNativeCpuBulkMemoryTest, TightLastRow2D) {
+    // The last row only needs to be `width` long, not a full pitch
+    constexpr size_t width = 24, height = 5, pitch = 40;
+    constexpr size_t size = pitch * (height - 1) + width;
+    constexpr size_t patternSize = 4;
+    const auto pattern = makePattern(patternSize);
+    void *src = nullptr, *dst = nullptr;
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, nullptr, size, &src));
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, nullptr, size, &dst));
+
+    ASSERT_SUCCESS(urEnqueueUSMFill2D(queue, src, pitch, patternSize,
+                                      pattern.data(), width, height, 0,
+                                      nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy2D(queue, true, dst, pitch, src, pitch,
+                                        width, height, 0, nullptr, nullptr));
+    std::vector<uint8_t> copy(width * height);
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy2D(queue, true, copy.data(), width, dst,
+                                        pitch, width, height, 0, nullptr,
+                                        nullptr));
+    expectPattern(copy.data(), copy.size(), pattern);
+
+    // whereas one more byte is out of bounds
+    ASSERT_EQ(urEnqueueUSMFill2D(queue, static_cast<uint8_t *>(src) + 1,
+                                 pitch, patternSize, pattern.data(), width,
+                                 height, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_EQ(urEnqueueUSMMemcpy2D(queue, true, dst, pitch,
+                                   static_cast<uint8_t *>(src) + 1, pitch,
+                                   width, height, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+
+    ASSERT_SUCCESS(urUSMFree(context, src));
+    ASSERT_SUCCESS(urUSMFree(context, dst));
+}
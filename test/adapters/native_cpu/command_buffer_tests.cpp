@@ -0,0 +1,284 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel.hpp"
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+#include <vector>
+
+struct urNativeCpuCommandBufferTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        for (auto &ptr : ptrs) {
+            ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                            size, &ptr));
+        }
+        ur_exp_command_buffer_desc_t desc{
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, false, false,
+            false};
+        ASSERT_SUCCESS(
+            urCommandBufferCreateExp(context, device, &desc, &cmdBuf));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueFinish(queue));
+        }
+        if (cmdBuf) {
+            EXPECT_SUCCESS(urCommandBufferReleaseExp(cmdBuf));
+        }
+        for (auto ptr : ptrs) {
+            if (ptr) {
+                EXPECT_SUCCESS(urUSMFree(context, ptr));
+            }
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    void expectFilled(void *ptr, uint32_t value) {
+        auto *data = static_cast<uint32_t *>(ptr);
+        for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+            ASSERT_EQ(data[i], value) << "index " << i;
+        }
+    }
+
+    static constexpr size_t size = 1 << 16;
+    void *ptrs[3] = {};
+    ur_exp_command_buffer_handle_t cmdBuf = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuCommandBufferTest);
+
+TEST_P(urNativeCpuCommandBufferTest, ReplaysInDependencyOrder) {
+    // fill(a) -> copy(a, b) -> copy(b, c), ordered through sync points only
+    const uint32_t pattern = 0xdeadbeef;
+    ur_exp_command_buffer_sync_point_t fill, copy;
+    ASSERT_SUCCESS(urCommandBufferAppendUSMFillExp(cmdBuf, ptrs[0], &pattern,
+                                                   sizeof(pattern), size, 0,
+                                                   nullptr, &fill));
+    ASSERT_SUCCESS(urCommandBufferAppendUSMMemcpyExp(
+        cmdBuf, ptrs[1], ptrs[0], size, 1, &fill, &copy));
+    ASSERT_SUCCESS(urCommandBufferAppendUSMMemcpyExp(
+        cmdBuf, ptrs[2], ptrs[1], size, 1, &copy, nullptr));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+
+    for (int replay = 0; replay < 8; replay++) {
+        for (auto ptr : ptrs) {
+            std::fill_n(static_cast<uint32_t *>(ptr), size / sizeof(uint32_t),
+                        0u);
+        }
+        ur_event_handle_t event = nullptr;
+        ASSERT_SUCCESS(
+            urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, &event));
+        ASSERT_SUCCESS(urEventWait(1, &event));
+        ASSERT_SUCCESS(urEventRelease(event));
+        for (auto ptr : ptrs) {
+            expectFilled(ptr, pattern);
+        }
+    }
+}
+
+TEST_P(urNativeCpuCommandBufferTest, InOrderCommandBuffer) {
+    ur_exp_command_buffer_handle_t inOrder = nullptr;
+    ur_exp_command_buffer_desc_t desc{UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC,
+                                      nullptr, false, true, false};
+    ASSERT_SUCCESS(urCommandBufferCreateExp(context, device, &desc, &inOrder));
+
+    const uint32_t first = 1, second = 2;
+    ASSERT_SUCCESS(urCommandBufferAppendUSMFillExp(
+        inOrder, ptrs[0], &first, sizeof(first), size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urCommandBufferAppendUSMFillExp(
+        inOrder, ptrs[0], &second, sizeof(second), size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urCommandBufferAppendUSMMemcpyExp(
+        inOrder, ptrs[1], ptrs[0], size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(inOrder));
+
+    ASSERT_SUCCESS(urCommandBufferEnqueueExp(inOrder, queue, 0, nullptr,
+                                             nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    expectFilled(ptrs[1], second);
+    ASSERT_SUCCESS(urCommandBufferReleaseExp(inOrder));
+}
+
+TEST_P(urNativeCpuCommandBufferTest, ReplaysOrderedWithQueue) {
+    const uint32_t pattern = 5;
+    ASSERT_SUCCESS(urCommandBufferAppendUSMMemcpyExp(
+        cmdBuf, ptrs[1], ptrs[0], size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptrs[0], sizeof(pattern), &pattern,
+                                    size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, ptrs[2], ptrs[1], size, 0,
+                                      nullptr, nullptr));
+    expectFilled(ptrs[2], pattern);
+}
+
+TEST_P(urNativeCpuCommandBufferTest, EmptyCommandBuffer) {
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuCommandBufferTest, ReleaseWhilePending) {
+    const uint32_t pattern = 9;
+    ASSERT_SUCCESS(urCommandBufferAppendUSMFillExp(cmdBuf, ptrs[0], &pattern,
+                                                   sizeof(pattern), size, 0,
+                                                   nullptr, nullptr));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+    for (int i = 0; i < 4; i++) {
+        ASSERT_SUCCESS(
+            urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr));
+    }
+    ASSERT_SUCCESS(urCommandBufferReleaseExp(cmdBuf));
+    cmdBuf = nullptr;
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    expectFilled(ptrs[0], pattern);
+}
+
+TEST_P(urNativeCpuCommandBufferTest, InvalidUse) {
+    const uint32_t pattern = 0;
+    ur_exp_command_buffer_sync_point_t invalid = 3;
+    ASSERT_EQ(urCommandBufferAppendUSMFillExp(cmdBuf, ptrs[0], &pattern,
+                                              sizeof(pattern), size, 1,
+                                              &invalid, nullptr),
+              UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_EXP);
+    ASSERT_EQ(urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_OPERATION);
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+    ASSERT_EQ(urCommandBufferAppendUSMFillExp(cmdBuf, ptrs[0], &pattern,
+                                              sizeof(pattern), size, 0, nullptr,
+                                              nullptr),
+              UR_RESULT_ERROR_INVALID_OPERATION);
+}
+
+TEST_P(urNativeCpuCommandBufferTest, GetInfo) {
+    uint32_t refCount = 0;
+    ASSERT_SUCCESS(urCommandBufferRetainExp(cmdBuf));
+    ASSERT_SUCCESS(urCommandBufferGetInfoExp(
+        cmdBuf, UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT, sizeof(refCount),
+        &refCount, nullptr));
+    EXPECT_EQ(refCount, 2u);
+    ASSERT_SUCCESS(urCommandBufferReleaseExp(cmdBuf));
+}
+
+TEST_P(urNativeCpuCommandBufferTest, ReleaseMemBeforeCommandBuffer) {
+    const uint32_t pattern = 5;
+    ur_mem_handle_t buffer = nullptr;
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                     nullptr, &buffer));
+    ur_exp_command_buffer_sync_point_t fill;
+    ASSERT_SUCCESS(urCommandBufferAppendMemBufferFillExp(
+        cmdBuf, buffer, &pattern, sizeof(pattern), 0, size, 0, nullptr,
+        &fill));
+    ASSERT_SUCCESS(urCommandBufferAppendMemBufferReadExp(
+        cmdBuf, buffer, 0, size, ptrs[0], 1, &fill, nullptr));
+    // The command-buffer keeps the buffer alive
+    ASSERT_SUCCESS(urMemRelease(buffer));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    expectFilled(ptrs[0], pattern);
+}
+
+static void emptyKernel(const native_cpu::NativeCPUArgDesc *,
+                        native_cpu::state *) {}
+
+static const nativecpu_entry binary[] = {
+    {"empty", reinterpret_cast<const unsigned char *>(emptyKernel)},
+    {nullptr, nullptr}};
+
+struct urNativeCpuCommandBufferKernelTest : urNativeCpuCommandBufferTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urNativeCpuCommandBufferTest::SetUp());
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(binary),
+            reinterpret_cast<const uint8_t *>(binary), nullptr, &program));
+        ASSERT_SUCCESS(urKernelCreate(program, "empty", &kernel));
+    }
+
+    void TearDown() override {
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urNativeCpuCommandBufferTest::TearDown());
+    }
+
+    ur_result_t appendKernel(ur_exp_command_buffer_handle_t hCommandBuffer,
+                             ur_exp_command_buffer_command_handle_t *phCommand) {
+        return urCommandBufferAppendKernelLaunchExp(
+            hCommandBuffer, kernel, 1, &offset, &globalSize, nullptr, 0,
+            nullptr, nullptr, phCommand);
+    }
+
+    ur_result_t update(ur_exp_command_buffer_command_handle_t hCommand) {
+        ur_exp_command_buffer_update_kernel_launch_desc_t desc{};
+        desc.stype =
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_DESC;
+        desc.newWorkDim = 1;
+        size_t newGlobalSize = 128;
+        desc.pNewGlobalWorkSize = &newGlobalSize;
+        return urCommandBufferUpdateKernelLaunchExp(hCommand, &desc);
+    }
+
+    const size_t offset = 0;
+    const size_t globalSize = 64;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuCommandBufferKernelTest);
+
+TEST_P(urNativeCpuCommandBufferKernelTest, NotUpdatable) {
+    ur_exp_command_buffer_command_handle_t command = nullptr;
+    ASSERT_SUCCESS(appendKernel(cmdBuf, &command));
+    ASSERT_NE(command, nullptr);
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+    EXPECT_EQ(update(command), UR_RESULT_ERROR_INVALID_OPERATION);
+    ASSERT_SUCCESS(urCommandBufferReleaseCommandExp(command));
+}
+
+TEST_P(urNativeCpuCommandBufferKernelTest, ReleaseCommandBufferFirst) {
+    ur_exp_command_buffer_desc_t desc{
+        UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, true, false,
+        false};
+    ur_exp_command_buffer_handle_t updatable = nullptr;
+    ASSERT_SUCCESS(
+        urCommandBufferCreateExp(context, device, &desc, &updatable));
+    ur_exp_command_buffer_command_handle_t commands[2] = {};
+    for (auto &command : commands) {
+        ASSERT_SUCCESS(appendKernel(updatable, &command));
+    }
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(updatable));
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(updatable, queue, 0, nullptr, nullptr));
+
+    // The commands keep the command-buffer alive, without it reporting their
+    // references.
+    ASSERT_SUCCESS(urCommandBufferRetainExp(updatable));
+    uint32_t refCount = 0;
+    ASSERT_SUCCESS(urCommandBufferGetInfoExp(
+        updatable, UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT,
+        sizeof(refCount), &refCount, nullptr));
+    EXPECT_EQ(refCount, 2u);
+    ASSERT_SUCCESS(urCommandBufferReleaseExp(updatable));
+    ASSERT_SUCCESS(urCommandBufferReleaseExp(updatable));
+
+    ASSERT_SUCCESS(urCommandBufferCommandGetInfoExp(
+        commands[0], UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT,
+        sizeof(refCount), &refCount, nullptr));
+    EXPECT_EQ(refCount, 1u);
+    ASSERT_SUCCESS(update(commands[0]));
+    ASSERT_SUCCESS(urCommandBufferReleaseCommandExp(commands[0]));
+    ASSERT_SUCCESS(update(commands[1]));
+    ASSERT_SUCCESS(urCommandBufferReleaseCommandExp(commands[1]));
+}
@@ -0,0 +1,203 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel.hpp"
+#include "program.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+static void kernel(const native_cpu::NativeCPUArgDesc *,
+                   native_cpu::state *) {}
+
+// Device globals, which the compiler leaves in the host process. The test isn't
+// linked with exported symbols, so the adapter takes their sizes from the
+// static symbol table, which also has the one with internal linkage. No symbol
+// starts at the last one, so its size isn't known.
+uint32_t deviceValues[16];
+static uint32_t hiddenValues[4];
+static uint64_t unsizedValues[4];
+
+static const nativecpu_entry binary[] = {
+    {"kernel", reinterpret_cast<const unsigned char *>(kernel)},
+    {"_Z12deviceValues", reinterpret_cast<const unsigned char *>(deviceValues)},
+    {"_Z12hiddenValues", reinterpret_cast<const unsigned char *>(hiddenValues)},
+    {"_Z7unsized", reinterpret_cast<const unsigned char *>(unsizedValues + 1)},
+    {nullptr, nullptr}};
+
+struct urNativeCpuDeviceGlobalTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        std::fill(std::begin(deviceValues), std::end(deviceValues), 0);
+        std::fill(std::begin(hiddenValues), std::end(hiddenValues), 0);
+
+#if !defined(__linux__)
+        GTEST_SKIP() << "Sizes of device globals are only known on Linux";
+#endif
+        ur_program_metadata_t metadata[3] = {};
+        addMapping(metadata[0], "values_id", "_Z12deviceValues");
+        addMapping(metadata[1], "hidden_id", "_Z12hiddenValues");
+        addMapping(metadata[2], "unsized_id", "_Z7unsized");
+        ur_program_properties_t properties{
+            UR_STRUCTURE_TYPE_PROGRAM_PROPERTIES, nullptr, 3, metadata};
+
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(binary),
+            reinterpret_cast<const uint8_t *>(binary), &properties,
+            &program));
+    }
+
+    void TearDown() override {
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    // Fills in the global_id_mapping metadata of device global `symbol`, whose
+    // value is a 64-bit size followed by the symbol name.
+    void addMapping(ur_program_metadata_t &metadata, const std::string &id,
+                    const std::string &symbol) {
+        names.push_back(id + "@global_id_mapping");
+        auto &value = values.emplace_back(sizeof(uint64_t) + symbol.size());
+        std::memcpy(value.data() + sizeof(uint64_t), symbol.data(),
+                    symbol.size());
+        metadata.pName = names.back().c_str();
+        metadata.type = UR_PROGRAM_METADATA_TYPE_BYTE_ARRAY;
+        metadata.size = value.size();
+        metadata.value.pData = value.data();
+    }
+
+    std::deque<std::string> names;
+    std::deque<std::vector<char>> values;
+    ur_program_handle_t program = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuDeviceGlobalTest);
+
+TEST_P(urNativeCpuDeviceGlobalTest, WritesAndReadsInPlace) {
+    const uint32_t values[4] = {1, 2, 3, 4};
+    ASSERT_SUCCESS(urEnqueueDeviceGlobalVariableWrite(
+        queue, program, "values_id", true, sizeof(values),
+        4 * sizeof(uint32_t), values, 0, nullptr, nullptr));
+    for (size_t i = 0; i < 16; i++) {
+        EXPECT_EQ(deviceValues[i], i >= 4 && i < 8 ? i - 3 : 0) << i;
+    }
+
+    deviceValues[15] = 42;
+    uint32_t read[2] = {};
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueDeviceGlobalVariableRead(
+        queue, program, "values_id", false, sizeof(read),
+        14 * sizeof(uint32_t), read, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    EXPECT_EQ(read[0], 0u);
+    EXPECT_EQ(read[1], 42u);
+
+    ur_command_t command;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_TYPE,
+                                  sizeof(command), &command, nullptr));
+    EXPECT_EQ(command, UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuDeviceGlobalTest, ChecksBounds) {
+    uint32_t value = 0;
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableRead(
+                  queue, program, "values_id", true, sizeof(value),
+                  sizeof(deviceValues), &value, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableWrite(
+                  queue, program, "values_id", true, 2 * sizeof(value),
+                  sizeof(deviceValues) - sizeof(value), &value, 0, nullptr,
+                  nullptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableRead(queue, program, "other_id",
+                                                true, sizeof(value), 0,
+                                                &value, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+}
+
+TEST_P(urNativeCpuDeviceGlobalTest, GetsPointerBySymbol) {
+    void *ptr = nullptr;
+    size_t size = 0;
+    ASSERT_SUCCESS(urProgramGetGlobalVariablePointer(
+        device, program, "_Z12deviceValues", &size, &ptr));
+    EXPECT_EQ(ptr, deviceValues);
+    EXPECT_EQ(size, sizeof(deviceValues));
+    EXPECT_EQ(urProgramGetGlobalVariablePointer(device, program, "kernel",
+                                                &size, &ptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+
+    // Device globals aren't kernels
+    ur_kernel_handle_t hKernel = nullptr;
+    EXPECT_EQ(urKernelCreate(program, "_Z12deviceValues", &hKernel),
+              UR_RESULT_ERROR_INVALID_KERNEL);
+    ASSERT_SUCCESS(urKernelCreate(program, "kernel", &hKernel));
+    EXPECT_SUCCESS(urKernelRelease(hKernel));
+}
+
+TEST_P(urNativeCpuDeviceGlobalTest, InternalLinkage) {
+    const uint32_t value = 7;
+    ASSERT_SUCCESS(urEnqueueDeviceGlobalVariableWrite(
+        queue, program, "hidden_id", true, sizeof(value),
+        3 * sizeof(uint32_t), &value, 0, nullptr, nullptr));
+    EXPECT_EQ(hiddenValues[3], 7u);
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableWrite(
+                  queue, program, "hidden_id", true, sizeof(value),
+                  sizeof(hiddenValues), &value, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+
+    void *ptr = nullptr;
+    size_t size = 0;
+    ASSERT_SUCCESS(urProgramGetGlobalVariablePointer(
+        device, program, "_Z12hiddenValues", &size, &ptr));
+    EXPECT_EQ(ptr, hiddenValues);
+    EXPECT_EQ(size, sizeof(hiddenValues));
+}
+
+TEST_P(urNativeCpuDeviceGlobalTest, UnknownSize) {
+    // Without a size the copies can't be checked, so they aren't done
+    uint32_t value = 1;
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableWrite(queue, program, "unsized_id",
+                                                 true, sizeof(value), 0,
+                                                 &value, 0, nullptr, nullptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    EXPECT_EQ(urEnqueueDeviceGlobalVariableRead(queue, program, "unsized_id",
+                                                true, sizeof(value), 0, &value,
+                                                0, nullptr, nullptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    EXPECT_EQ(value, 1u);
+
+    void *ptr = nullptr;
+    size_t size = 0;
+    EXPECT_EQ(urProgramGetGlobalVariablePointer(device, program, "_Z7unsized",
+                                                &size, &ptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    ASSERT_SUCCESS(urProgramGetGlobalVariablePointer(
+        device, program, "_Z7unsized", nullptr, &ptr));
+    EXPECT_EQ(ptr, unsizedValues + 1);
+}
+
+TEST_P(urNativeCpuDeviceGlobalTest, HostPipesUnsupported) {
+    // Kernels have no way to reach a host pipe, so it isn't offered
+    ur_bool_t supported = true;
+    ASSERT_SUCCESS(
+        urDeviceGetInfo(device, UR_DEVICE_INFO_HOST_PIPE_READ_WRITE_SUPPORTED,
+                        sizeof(supported), &supported, nullptr));
+    EXPECT_FALSE(supported);
+
+    uint32_t value = 0;
+    EXPECT_EQ(urEnqueueWriteHostPipe(queue, program, "pipe", true, &value,
+                                     sizeof(value), 0, nullptr, nullptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    EXPECT_EQ(urEnqueueReadHostPipe(queue, program, "pipe", true, &value,
+                                    sizeof(value), 0, nullptr, nullptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <array>
+#include <cstdint>
+#include <unistd.h>
+
+namespace {
+template <typename T>
+T getInfo(ur_device_handle_t device, ur_device_info_t info) {
+    T value{};
+    EXPECT_SUCCESS(
+        urDeviceGetInfo(device, info, sizeof(value), &value, nullptr));
+    return value;
+}
+} // namespace
+
+using urNativeCpuDeviceInfoTest = uur::urDeviceTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuDeviceInfoTest);
+
+TEST_P(urNativeCpuDeviceInfoTest, MemorySizes) {
+    const uint64_t physical = static_cast<uint64_t>(sysconf(_SC_PHYS_PAGES)) *
+                              static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const auto globalMem =
+        getInfo<uint64_t>(device, UR_DEVICE_INFO_GLOBAL_MEM_SIZE);
+    EXPECT_EQ(globalMem, physical);
+    const auto freeMem =
+        getInfo<uint64_t>(device, UR_DEVICE_INFO_GLOBAL_MEM_FREE);
+    EXPECT_GT(freeMem, 0u);
+    EXPECT_LE(freeMem, globalMem);
+    EXPECT_EQ(getInfo<uint64_t>(device, UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE),
+              globalMem);
+    EXPECT_GT(getInfo<uint64_t>(device, UR_DEVICE_INFO_LOCAL_MEM_SIZE), 0u);
+}
+
+TEST_P(urNativeCpuDeviceInfoTest, Caches) {
+    const auto lineSize =
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_GLOBAL_MEM_CACHELINE_SIZE);
+    EXPECT_GE(lineSize, 16u);
+    EXPECT_EQ(lineSize & (lineSize - 1), 0u);
+    const auto cacheSize =
+        getInfo<uint64_t>(device, UR_DEVICE_INFO_GLOBAL_MEM_CACHE_SIZE);
+    if (cacheSize == 0) {
+        GTEST_SKIP() << "no cache information";
+    }
+    // Local memory is sized to a cache closer to the cores than the last
+    // level one
+    EXPECT_LE(getInfo<uint64_t>(device, UR_DEVICE_INFO_LOCAL_MEM_SIZE),
+              cacheSize);
+}
+
+TEST_P(urNativeCpuDeviceInfoTest, VectorWidths) {
+    const auto chars =
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_CHAR);
+    EXPECT_TRUE(chars == 16 || chars == 32 || chars == 64) << chars;
+    EXPECT_EQ(
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_CHAR),
+        chars);
+    EXPECT_EQ(
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_HALF),
+        chars / 2);
+    EXPECT_EQ(
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_PREFERRED_VECTOR_WIDTH_FLOAT),
+        chars / 4);
+    EXPECT_EQ(
+        getInfo<uint32_t>(device, UR_DEVICE_INFO_NATIVE_VECTOR_WIDTH_DOUBLE),
+        chars / 8);
+}
+
+TEST_P(urNativeCpuDeviceInfoTest, WorkItemSizes) {
+    const auto maxGroupSize =
+        getInfo<size_t>(device, UR_DEVICE_INFO_MAX_WORK_GROUP_SIZE);
+    const auto sizes = getInfo<std::array<size_t, 3>>(
+        device, UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES);
+    for (size_t size : sizes) {
+        EXPECT_EQ(size, maxGroupSize);
+    }
+}
+
+TEST_P(urNativeCpuDeviceInfoTest, SubDevicesShareHostInfo) {
+    ur_device_partition_property_t prop{UR_DEVICE_PARTITION_EQUALLY, {}};
+    prop.value.equally = 1;
+    ur_device_partition_properties_t properties{
+        UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr, &prop, 1};
+    ur_device_handle_t subDevice = nullptr;
+    ASSERT_SUCCESS(
+        urDevicePartition(device, &properties, 1, &subDevice, nullptr));
+    for (auto info : {UR_DEVICE_INFO_GLOBAL_MEM_SIZE,
+                      UR_DEVICE_INFO_GLOBAL_MEM_CACHE_SIZE,
+                      UR_DEVICE_INFO_LOCAL_MEM_SIZE}) {
+        EXPECT_EQ(getInfo<uint64_t>(subDevice, info),
+                  getInfo<uint64_t>(device, info));
+    }
+    ASSERT_SUCCESS(urDeviceRelease(subDevice));
+}
@@ -0,0 +1,229 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+uint32_t computeUnits(ur_device_handle_t device) {
+    uint32_t units = 0;
+    EXPECT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_MAX_COMPUTE_UNITS,
+                                   sizeof(units), &units, nullptr));
+    return units;
+}
+
+ur_result_t partition(ur_device_handle_t device,
+                      const std::vector<ur_device_partition_property_t> &props,
+                      std::vector<ur_device_handle_t> &subDevices) {
+    ur_device_partition_properties_t properties{
+        UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr, props.data(),
+        props.size()};
+    uint32_t count = 0;
+    auto ret = urDevicePartition(device, &properties, 0, nullptr, &count);
+    if (ret != UR_RESULT_SUCCESS) {
+        return ret;
+    }
+    subDevices.resize(count);
+    return urDevicePartition(device, &properties, count, subDevices.data(),
+                             nullptr);
+}
+
+ur_device_partition_property_t equally(uint32_t units) {
+    ur_device_partition_property_t prop{UR_DEVICE_PARTITION_EQUALLY, {}};
+    prop.value.equally = units;
+    return prop;
+}
+
+ur_device_partition_property_t byCount(uint32_t units) {
+    ur_device_partition_property_t prop{UR_DEVICE_PARTITION_BY_COUNTS, {}};
+    prop.value.count = units;
+    return prop;
+}
+
+ur_device_partition_property_t byNuma() {
+    ur_device_partition_property_t prop{
+        UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN, {}};
+    prop.value.affinity_domain = UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA;
+    return prop;
+}
+
+void releaseAll(const std::vector<ur_device_handle_t> &devices) {
+    for (auto device : devices) {
+        EXPECT_SUCCESS(urDeviceRelease(device));
+    }
+}
+} // namespace
+
+using urNativeCpuDevicePartitionTest = uur::urDeviceTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuDevicePartitionTest);
+
+TEST_P(urNativeCpuDevicePartitionTest, Equally) {
+    const uint32_t units = computeUnits(device);
+    const uint32_t perDevice = units > 1 ? units / 2 : 1;
+    std::vector<ur_device_handle_t> subDevices;
+    ASSERT_SUCCESS(partition(device, {equally(perDevice)}, subDevices));
+    ASSERT_EQ(subDevices.size(), units / perDevice);
+
+    for (auto subDevice : subDevices) {
+        EXPECT_EQ(computeUnits(subDevice), perDevice);
+        ur_device_handle_t parent = nullptr;
+        ASSERT_SUCCESS(urDeviceGetInfo(subDevice,
+                                       UR_DEVICE_INFO_PARENT_DEVICE,
+                                       sizeof(parent), &parent, nullptr));
+        EXPECT_EQ(parent, device);
+        ur_device_partition_property_t type{};
+        ASSERT_SUCCESS(urDeviceGetInfo(subDevice, UR_DEVICE_INFO_PARTITION_TYPE,
+                                       sizeof(type), &type, nullptr));
+        EXPECT_EQ(type.type, UR_DEVICE_PARTITION_EQUALLY);
+        EXPECT_EQ(type.value.equally, perDevice);
+    }
+
+    // Partitioning again hands out the same sub-devices while they're alive
+    std::vector<ur_device_handle_t> again;
+    ASSERT_SUCCESS(partition(device, {equally(perDevice)}, again));
+    EXPECT_EQ(again, subDevices);
+    uint32_t refCount = 0;
+    ASSERT_SUCCESS(urDeviceGetInfo(again[0], UR_DEVICE_INFO_REFERENCE_COUNT,
+                                   sizeof(refCount), &refCount, nullptr));
+    EXPECT_EQ(refCount, 2u);
+    releaseAll(again);
+    releaseAll(subDevices);
+
+    // and new ones once they have been released
+    ASSERT_SUCCESS(partition(device, {equally(perDevice)}, again));
+    ASSERT_EQ(again.size(), units / perDevice);
+    EXPECT_EQ(computeUnits(again[0]), perDevice);
+    releaseAll(again);
+}
+
+TEST_P(urNativeCpuDevicePartitionTest, RootDeviceReferenceCount) {
+    auto refCount = [](ur_device_handle_t hDevice) {
+        uint32_t count = 0;
+        EXPECT_SUCCESS(urDeviceGetInfo(hDevice, UR_DEVICE_INFO_REFERENCE_COUNT,
+                                       sizeof(count), &count, nullptr));
+        return count;
+    };
+
+    // Retaining and releasing a root device leaves its count unchanged, even
+    // when the releases aren't paired
+    const uint32_t before = refCount(device);
+    ASSERT_SUCCESS(urDeviceRetain(device));
+    EXPECT_EQ(refCount(device), before);
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    EXPECT_EQ(refCount(device), before);
+
+    // and so does partitioning it, whereas sub-devices are kept alive by
+    // their own sub-devices
+    std::vector<ur_device_handle_t> subDevices;
+    ASSERT_SUCCESS(partition(device, {equally(1)}, subDevices));
+    EXPECT_EQ(refCount(device), before);
+    EXPECT_EQ(refCount(subDevices[0]), 1u);
+    std::vector<ur_device_handle_t> subSubDevices;
+    ASSERT_SUCCESS(partition(subDevices[0], {equally(1)}, subSubDevices));
+    EXPECT_EQ(refCount(subDevices[0]), 1u + subSubDevices.size());
+    releaseAll(subDevices);
+    releaseAll(subSubDevices);
+    EXPECT_EQ(refCount(device), before);
+}
+
+TEST_P(urNativeCpuDevicePartitionTest, ByCounts) {
+    const uint32_t units = computeUnits(device);
+    if (units < 2) {
+        GTEST_SKIP() << "needs at least two compute units";
+    }
+    std::vector<ur_device_handle_t> subDevices;
+    ASSERT_SUCCESS(
+        partition(device, {byCount(1), byCount(units - 1)}, subDevices));
+    ASSERT_EQ(subDevices.size(), 2u);
+    EXPECT_EQ(computeUnits(subDevices[0]), 1u);
+    EXPECT_EQ(computeUnits(subDevices[1]), units - 1);
+
+    // Sub-devices can be partitioned further
+    std::vector<ur_device_handle_t> subSubDevices;
+    ASSERT_SUCCESS(partition(subDevices[1], {equally(1)}, subSubDevices));
+    EXPECT_EQ(subSubDevices.size(), units - 1);
+    releaseAll(subSubDevices);
+    releaseAll(subDevices);
+
+    EXPECT_EQ(partition(device, {byCount(units), byCount(1)}, subDevices),
+              UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT);
+    EXPECT_EQ(partition(device, {byCount(0)}, subDevices),
+              UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT);
+}
+
+TEST_P(urNativeCpuDevicePartitionTest, AffinityDomain) {
+    ur_device_affinity_domain_flags_t domains = 0;
+    ASSERT_SUCCESS(urDeviceGetInfo(device,
+                                   UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN,
+                                   sizeof(domains), &domains, nullptr));
+    std::vector<ur_device_handle_t> subDevices;
+    if (!(domains & UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA)) {
+        // A single NUMA node can't be split
+        EXPECT_EQ(partition(device, {byNuma()}, subDevices),
+                  UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+        return;
+    }
+    ASSERT_SUCCESS(partition(device, {byNuma()}, subDevices));
+    ASSERT_GT(subDevices.size(), 1u);
+    uint32_t totalUnits = 0;
+    for (auto subDevice : subDevices) {
+        totalUnits += computeUnits(subDevice);
+        ASSERT_SUCCESS(urDeviceGetInfo(
+            subDevice, UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN,
+            sizeof(domains), &domains, nullptr));
+        EXPECT_EQ(domains, 0u);
+    }
+    EXPECT_EQ(totalUnits, computeUnits(device));
+    releaseAll(subDevices);
+}
+
+TEST_P(urNativeCpuDevicePartitionTest, InvalidProperties) {
+    std::vector<ur_device_handle_t> subDevices;
+    EXPECT_EQ(partition(device, {equally(0)}, subDevices),
+              UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(partition(device, {equally(computeUnits(device) + 1)},
+                        subDevices),
+              UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+    EXPECT_EQ(partition(device, {equally(1), byCount(1)}, subDevices),
+              UR_RESULT_ERROR_INVALID_VALUE);
+    ur_device_partition_property_t cslice{UR_DEVICE_PARTITION_BY_CSLICE, {}};
+    EXPECT_EQ(partition(device, {cslice}, subDevices),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+}
+
+TEST_P(urNativeCpuDevicePartitionTest, SubDeviceQueue) {
+    std::vector<ur_device_handle_t> subDevices;
+    ASSERT_SUCCESS(partition(device, {equally(1)}, subDevices));
+    ASSERT_FALSE(subDevices.empty());
+    ur_device_handle_t subDevice = subDevices.back();
+
+    ur_context_handle_t context = nullptr;
+    ASSERT_SUCCESS(urContextCreate(1, &subDevice, nullptr, &context));
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, subDevice, nullptr, &queue));
+
+    // Large enough to run on the sub-device's workers
+    constexpr size_t size = size_t{8} << 20;
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, subDevice, nullptr, nullptr, size, &ptr));
+    const uint32_t pattern = 0xdeadbeef;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    const auto *values = static_cast<const uint32_t *>(ptr);
+    for (size_t i = 0; i < size / sizeof(pattern); i++) {
+        ASSERT_EQ(values[i], pattern) << "index " << i;
+    }
+
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    ASSERT_SUCCESS(urContextRelease(context));
+    releaseAll(subDevices);
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Times streams of back-to-back small kernels. On an in-order queue the
+// launches are run in batches, which an out-of-order queue where each launch
+// waits for the previous one never does, so comparing the two gives the cost
+// of dispatching each kernel to the thread pool separately. Run with
+// SYCL_NATIVE_CPU_KERNEL_BATCHING=0 to time the in-order queue without
+// batching.
+
+#include "kernel.hpp"
+#include "program.hpp"
+
+#include <ur_api.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t numLaunches = 10000;
+
+void increment(const native_cpu::NativeCPUArgDesc *args,
+               native_cpu::state *state) {
+    static_cast<float *>(args[0].MPtr)[state->MGlobal_id[0]] += 1.0f;
+}
+
+const nativecpu_entry binary[] = {
+    {"increment", reinterpret_cast<const unsigned char *>(increment)},
+    {nullptr, nullptr}};
+
+#define CHECK(call)                                                            \
+    do {                                                                       \
+        if (ur_result_t res = (call)) {                                        \
+            std::fprintf(stderr, "%s failed: %d\n", #call, res);               \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+// Microseconds per launch of `numLaunches` launches of `kernel` over
+// `globalSize` work-items, each depending on the previous one.
+double timeLaunches(ur_queue_handle_t queue, ur_kernel_handle_t kernel,
+                    size_t globalSize, bool chainEvents) {
+    const size_t offset = 0;
+    ur_event_handle_t last = nullptr;
+    auto start = clock_type::now();
+    for (size_t i = 0; i < numLaunches; i++) {
+        ur_event_handle_t event = nullptr;
+        CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &globalSize,
+                                    nullptr, last ? 1 : 0,
+                                    last ? &last : nullptr,
+                                    chainEvents ? &event : nullptr));
+        if (last) {
+            CHECK(urEventRelease(last));
+        }
+        last = event;
+    }
+    CHECK(urQueueFinish(queue));
+    auto end = clock_type::now();
+    if (last) {
+        CHECK(urEventRelease(last));
+    }
+    return std::chrono::duration<double, std::micro>(end - start).count() /
+           static_cast<double>(numLaunches);
+}
+
+} // namespace
+
+int main() {
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_program_handle_t program = nullptr;
+    CHECK(urProgramCreateWithBinary(context, device, sizeof(binary),
+                                    reinterpret_cast<const uint8_t *>(binary),
+                                    nullptr, &program));
+    ur_kernel_handle_t kernel = nullptr;
+    CHECK(urKernelCreate(program, "increment", &kernel));
+
+    ur_queue_handle_t inOrder = nullptr;
+    CHECK(urQueueCreate(context, device, nullptr, &inOrder));
+    ur_queue_properties_t outOfOrderProps{
+        UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+        UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE};
+    ur_queue_handle_t outOfOrder = nullptr;
+    CHECK(urQueueCreate(context, device, &outOfOrderProps, &outOfOrder));
+
+    const char *batching = std::getenv("SYCL_NATIVE_CPU_KERNEL_BATCHING");
+    std::printf("launches=%zu batching=%s\n", numLaunches,
+                batching ? batching : "default");
+    std::printf("%10s %14s %14s %8s\n", "global", "chained us", "in-order us",
+                "speedup");
+    for (size_t globalSize : {size_t{1}, size_t{64}, size_t{4096}}) {
+        std::vector<float> data(globalSize);
+        CHECK(urKernelSetArgPointer(kernel, 0, nullptr, data.data()));
+        // Warm up the workers and their arenas
+        timeLaunches(inOrder, kernel, globalSize, false);
+        double chained = timeLaunches(outOfOrder, kernel, globalSize, true);
+        double inOrderTime = timeLaunches(inOrder, kernel, globalSize, false);
+        std::printf("%10zu %14.2f %14.2f %7.2fx\n", globalSize, chained,
+                    inOrderTime, chained / inOrderTime);
+    }
+
+    CHECK(urQueueRelease(inOrder));
+    CHECK(urQueueRelease(outOfOrder));
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urContextRelease(context));
+    CHECK(urAdapterRelease(adapter));
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel.hpp"
+#include "program.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdint>
+#include <vector>
+
+// data[i] = data[i] * 3 + value, which gives a different result if two
+// launches run out of order
+static void multiplyAdd(const native_cpu::NativeCPUArgDesc *args,
+                        native_cpu::state *state) {
+    auto data = static_cast<uint64_t *>(args[0].MPtr);
+    auto value = *static_cast<const uint64_t *>(args[1].MPtr);
+    auto &item = data[state->MGlobal_id[0]];
+    item = item * 3 + value;
+}
+
+static const nativecpu_entry binary[] = {
+    {"multiplyAdd", reinterpret_cast<const unsigned char *>(multiplyAdd)},
+    {nullptr, nullptr}};
+
+struct urNativeCpuKernelBatchTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(binary),
+            reinterpret_cast<const uint8_t *>(binary), nullptr, &program));
+        ASSERT_SUCCESS(urKernelCreate(program, "multiplyAdd", &kernel));
+        ASSERT_SUCCESS(urKernelSetArgPointer(kernel, 0, nullptr, data.data()));
+    }
+
+    void TearDown() override {
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    void launch(uint64_t value, uint32_t numEventsInWaitList = 0,
+                const ur_event_handle_t *phEventWaitList = nullptr,
+                ur_event_handle_t *phEvent = nullptr) {
+        ASSERT_SUCCESS(
+            urKernelSetArgValue(kernel, 1, sizeof(value), nullptr, &value));
+        const size_t offset = 0;
+        const size_t size = data.size();
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                             nullptr, numEventsInWaitList,
+                                             phEventWaitList, phEvent));
+    }
+
+    // Value of the elements after launches with the values [0, numLaunches)
+    static uint64_t expected(uint64_t initial, uint64_t numLaunches) {
+        for (uint64_t value = 0; value < numLaunches; value++) {
+            initial = initial * 3 + value;
+        }
+        return initial;
+    }
+
+    std::vector<uint64_t> data = std::vector<uint64_t>(1024, 1);
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuKernelBatchTest);
+
+TEST_P(urNativeCpuKernelBatchTest, LaunchesRunInOrder) {
+    // More launches than fit in a batch
+    const uint64_t numLaunches = 300;
+    for (uint64_t value = 0; value < numLaunches; value++) {
+        launch(value);
+    }
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    for (auto item : data) {
+        ASSERT_EQ(item, expected(1, numLaunches));
+    }
+}
+
+TEST_P(urNativeCpuKernelBatchTest, EventsCompleteInOrder) {
+    std::vector<ur_event_handle_t> events(100);
+    for (uint64_t value = 0; value < events.size(); value++) {
+        launch(value, 0, nullptr, &events[value]);
+    }
+    ASSERT_SUCCESS(urEventWait(1, &events.back()));
+    for (auto event : events) {
+        ur_event_status_t status;
+        ASSERT_SUCCESS(urEventGetInfo(event,
+                                      UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                      sizeof(status), &status, nullptr));
+        EXPECT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+        EXPECT_SUCCESS(urEventRelease(event));
+    }
+    for (auto item : data) {
+        ASSERT_EQ(item, expected(1, events.size()));
+    }
+}
+
+TEST_P(urNativeCpuKernelBatchTest, OtherCommandsStayInOrder) {
+    // A copy between two launches sees the first and not the second
+    std::vector<uint64_t> copy(data.size());
+    launch(0);
+    launch(1);
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, copy.data(), data.data(),
+                                      data.size() * sizeof(uint64_t), 0,
+                                      nullptr, nullptr));
+    launch(2);
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    for (size_t i = 0; i < data.size(); i++) {
+        ASSERT_EQ(copy[i], expected(1, 2));
+        ASSERT_EQ(data[i], expected(1, 3));
+    }
+}
+
+TEST_P(urNativeCpuKernelBatchTest, WaitListAcrossQueues) {
+    // The second launch can't join the batch of the first, as it also waits
+    // for the copy on the other queue
+    ur_queue_handle_t otherQueue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &otherQueue));
+    std::vector<uint64_t> copy(data.size());
+    ur_event_handle_t launchEvent = nullptr;
+    launch(0, 0, nullptr, &launchEvent);
+    ur_event_handle_t copyEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(otherQueue, false, copy.data(),
+                                      data.data(),
+                                      data.size() * sizeof(uint64_t), 1,
+                                      &launchEvent, &copyEvent));
+    launch(1, 1, &copyEvent);
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    for (size_t i = 0; i < data.size(); i++) {
+        ASSERT_EQ(copy[i], expected(1, 1));
+        ASSERT_EQ(data[i], expected(1, 2));
+    }
+    ASSERT_SUCCESS(urEventRelease(launchEvent));
+    ASSERT_SUCCESS(urEventRelease(copyEvent));
+    ASSERT_SUCCESS(urQueueRelease(otherQueue));
+}
+
+TEST_P(urNativeCpuKernelBatchTest, InvalidWaitList) {
+    // Launches that would otherwise join the open batch check the wait list
+    // all the same
+    launch(0);
+    ur_event_handle_t event = nullptr;
+    launch(1, 0, nullptr, &event);
+    ur_event_handle_t nullEvent = nullptr;
+    const size_t offset = 0, size = data.size();
+    EXPECT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr,
+                                    0, &event, nullptr),
+              UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    EXPECT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr,
+                                    1, nullptr, nullptr),
+              UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    EXPECT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr,
+                                    1, &nullEvent, nullptr),
+              UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    for (auto item : data) {
+        ASSERT_EQ(item, expected(1, 2));
+    }
+    ASSERT_SUCCESS(urEventRelease(event));
+}
@@ -0,0 +1,166 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "kernel.hpp"
+#include "program.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+TEST(KernelTableTest, FindsKernels) {
+    static const unsigned char code[1] = {};
+    std::vector<std::string> names;
+    for (int i = 0; i < 100; i++) {
+        names.push_back("kernel_" + std::to_string(i));
+    }
+
+    native_cpu::kernel_table_t table;
+    EXPECT_EQ(table.find("kernel_0"), nullptr);
+    for (size_t i = 0; i < names.size(); i++) {
+        native_cpu::kernel_entry_t entry{};
+        entry.name = names[i];
+        entry.hash = native_cpu::kernel_table_t::hash(entry.name);
+        entry.ptr = code + (i % 2);
+        table.insert(entry);
+    }
+    // The first of two kernels with the same name is kept
+    native_cpu::kernel_entry_t duplicate{};
+    duplicate.name = names[0];
+    duplicate.hash = native_cpu::kernel_table_t::hash(duplicate.name);
+    duplicate.ptr = code + 1;
+    table.insert(duplicate);
+
+    EXPECT_EQ(table.size(), names.size());
+    for (size_t i = 0; i < names.size(); i++) {
+        auto *entry = table.find(names[i]);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->name, names[i]);
+        EXPECT_EQ(entry->ptr, code + (i % 2));
+    }
+    EXPECT_EQ(table.find("kernel_100"), nullptr);
+    EXPECT_EQ(table.find("kernel_"), nullptr);
+}
+
+static void firstKernel(const native_cpu::NativeCPUArgDesc *,
+                        native_cpu::state *) {}
+static void secondKernel(const native_cpu::NativeCPUArgDesc *,
+                         native_cpu::state *) {}
+
+static const nativecpu_entry binary[] = {
+    {"first", reinterpret_cast<const unsigned char *>(firstKernel)},
+    {"second", reinterpret_cast<const unsigned char *>(secondKernel)},
+    {nullptr, nullptr}};
+
+struct urNativeCpuKernelTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::SetUp());
+
+        // 64-bit size followed by the sizes of the dimensions
+        const uint32_t reqdWGSize[] = {4, 2};
+        reqdWGSizeValue.resize(sizeof(uint64_t) + sizeof(reqdWGSize));
+        std::memcpy(reqdWGSizeValue.data() + sizeof(uint64_t), reqdWGSize,
+                    sizeof(reqdWGSize));
+        ur_program_metadata_t metadata{};
+        metadata.pName = "second@reqd_work_group_size";
+        metadata.type = UR_PROGRAM_METADATA_TYPE_BYTE_ARRAY;
+        metadata.size = reqdWGSizeValue.size();
+        metadata.value.pData = reqdWGSizeValue.data();
+        ur_program_properties_t properties{
+            UR_STRUCTURE_TYPE_PROGRAM_PROPERTIES, nullptr, 1, &metadata};
+
+        ASSERT_SUCCESS(urProgramCreateWithBinary(
+            context, device, sizeof(binary),
+            reinterpret_cast<const uint8_t *>(binary), &properties,
+            &program));
+    }
+
+    void TearDown() override {
+        if (program) {
+            EXPECT_SUCCESS(urProgramRelease(program));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    std::string getName(ur_kernel_handle_t kernel) {
+        size_t size = 0;
+        EXPECT_SUCCESS(urKernelGetInfo(kernel, UR_KERNEL_INFO_FUNCTION_NAME, 0,
+                                       nullptr, &size));
+        std::string name(size, '\0');
+        EXPECT_SUCCESS(urKernelGetInfo(kernel, UR_KERNEL_INFO_FUNCTION_NAME,
+                                       size, name.data(), nullptr));
+        return name.c_str();
+    }
+
+    std::vector<size_t> getCompileWGSize(ur_kernel_handle_t kernel) {
+        std::vector<size_t> size(3);
+        EXPECT_SUCCESS(urKernelGetGroupInfo(
+            kernel, device, UR_KERNEL_GROUP_INFO_COMPILE_WORK_GROUP_SIZE,
+            size.size() * sizeof(size_t), size.data(), nullptr));
+        return size;
+    }
+
+    std::vector<char> reqdWGSizeValue;
+    ur_program_handle_t program = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuKernelTest);
+
+TEST_P(urNativeCpuKernelTest, CreatesKernels) {
+    ur_kernel_handle_t first = nullptr;
+    ur_kernel_handle_t second = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, "first", &first));
+    ASSERT_SUCCESS(urKernelCreate(program, "second", &second));
+
+    EXPECT_EQ(getName(first), "first");
+    EXPECT_EQ(getName(second), "second");
+    EXPECT_FALSE(first->hasReqdWGSize());
+    EXPECT_TRUE(second->hasReqdWGSize());
+    EXPECT_EQ(getCompileWGSize(first), std::vector<size_t>({0, 0, 0}));
+    EXPECT_EQ(getCompileWGSize(second), std::vector<size_t>({4, 2, 1}));
+
+    ur_kernel_handle_t missing = nullptr;
+    EXPECT_EQ(urKernelCreate(program, "third", &missing),
+              UR_RESULT_ERROR_INVALID_KERNEL);
+
+    EXPECT_SUCCESS(urKernelRelease(first));
+    EXPECT_SUCCESS(urKernelRelease(second));
+}
+
+TEST_P(urNativeCpuKernelTest, ReusesReleasedKernels) {
+    ur_kernel_handle_t kernel = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, "second", &kernel));
+    const int value = 42;
+    ASSERT_SUCCESS(
+        urKernelSetArgValue(kernel, 0, sizeof(value), nullptr, &value));
+    ASSERT_SUCCESS(urKernelRetain(kernel));
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+    const auto released = kernel;
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+
+    // The kernel object comes back from the free-list, without the state of
+    // its previous use
+    ASSERT_SUCCESS(urKernelCreate(program, "first", &kernel));
+    EXPECT_EQ(kernel, released);
+    EXPECT_EQ(kernel->getReferenceCount(), 1u);
+    EXPECT_EQ(getName(kernel), "first");
+    EXPECT_FALSE(kernel->hasReqdWGSize());
+    EXPECT_TRUE(kernel->captureArgs()._args.empty());
+    EXPECT_SUCCESS(urKernelRelease(kernel));
+}
+
+TEST_P(urNativeCpuKernelTest, KernelKeepsProgramAlive) {
+    ur_kernel_handle_t kernel = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, "second", &kernel));
+    EXPECT_EQ(program->getReferenceCount(), 2u);
+    ASSERT_SUCCESS(urProgramRelease(program));
+    program = nullptr;
+
+    EXPECT_EQ(getName(kernel), "second");
+    EXPECT_EQ(getCompileWGSize(kernel), std::vector<size_t>({4, 2, 1}));
+    EXPECT_SUCCESS(urKernelRelease(kernel));
+}
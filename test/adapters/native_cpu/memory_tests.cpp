@@ -0,0 +1,128 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "memory.hpp"
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+struct urNativeCpuBufferTest : uur::urQueueTest {
+    void TearDown() override {
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    void *map(size_t offset, size_t size) {
+        void *ptr = nullptr;
+        EXPECT_SUCCESS(urEnqueueMemBufferMap(
+            queue, buffer, true, UR_MAP_FLAG_READ | UR_MAP_FLAG_WRITE, offset,
+            size, 0, nullptr, nullptr, &ptr));
+        return ptr;
+    }
+
+    void unmap(void *ptr) {
+        EXPECT_SUCCESS(
+            urEnqueueMemUnmap(queue, buffer, ptr, 0, nullptr, nullptr));
+    }
+
+    ur_mem_handle_t buffer = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuBufferTest);
+
+TEST_P(urNativeCpuBufferTest, UseHostPointerAliases) {
+    std::vector<uint32_t> host(4096);
+    std::iota(host.begin(), host.end(), 0);
+    const size_t size = host.size() * sizeof(uint32_t);
+    ur_buffer_properties_t properties{UR_STRUCTURE_TYPE_BUFFER_PROPERTIES,
+                                      nullptr, host.data()};
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_USE_HOST_POINTER,
+                                     size, &properties, &buffer));
+
+    // Maps are the host memory itself
+    auto mapped = static_cast<uint32_t *>(map(16, size - 16));
+    EXPECT_EQ(mapped, host.data() + 4);
+    mapped[0] = 42;
+    unmap(mapped);
+    EXPECT_EQ(host[4], 42u);
+
+    // and so are reads and writes of the whole buffer
+    const std::vector<uint32_t> values(host.size(), 7);
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, true, 0, size,
+                                           values.data(), 0, nullptr,
+                                           nullptr));
+    EXPECT_EQ(host, values);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, true, 0, size,
+                                          host.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(host, values);
+}
+
+TEST_P(urNativeCpuBufferTest, CopyHostPointerCopies) {
+    std::vector<uint8_t> host(1000);
+    std::iota(host.begin(), host.end(), uint8_t{0});
+    const auto initial = host;
+    ur_buffer_properties_t properties{UR_STRUCTURE_TYPE_BUFFER_PROPERTIES,
+                                      nullptr, host.data()};
+    ASSERT_SUCCESS(urMemBufferCreate(context,
+                                     UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER,
+                                     host.size(), &properties, &buffer));
+    auto mapped = static_cast<uint8_t *>(map(0, host.size()));
+    EXPECT_NE(mapped, host.data());
+    unmap(mapped);
+
+    // Later changes to the host memory don't reach the buffer
+    std::fill(host.begin(), host.end(), 0);
+    std::vector<uint8_t> result(host.size());
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, true, 0, host.size(),
+                                          result.data(), 0, nullptr, nullptr));
+    EXPECT_EQ(result, initial);
+}
+
+TEST_P(urNativeCpuBufferTest, OwnedMemoryIsAligned) {
+    for (size_t size : {size_t{1}, size_t{100},
+                        native_cpu::bufferMapThreshold + 1}) {
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &buffer));
+        void *mapped = map(0, size);
+        const size_t alignment = size >= native_cpu::bufferMapThreshold
+                                     ? 4096
+                                     : native_cpu::bufferAlignment;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped) % alignment, 0u)
+            << "size " << size;
+        // The whole buffer is usable
+        static_cast<uint8_t *>(mapped)[size - 1] = 1;
+        unmap(mapped);
+        ASSERT_SUCCESS(urMemRelease(buffer));
+        buffer = nullptr;
+    }
+}
+
+TEST_P(urNativeCpuBufferTest, ReadRectOntoItself) {
+    constexpr size_t width = 16, height = 8, pitch = 32;
+    std::vector<uint8_t> host(pitch * height);
+    std::iota(host.begin(), host.end(), uint8_t{0});
+    const auto initial = host;
+    ur_buffer_properties_t properties{UR_STRUCTURE_TYPE_BUFFER_PROPERTIES,
+                                      nullptr, host.data()};
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_USE_HOST_POINTER,
+                                     host.size(), &properties, &buffer));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueMemBufferReadRect(
+        queue, buffer, false, {4, 2, 0}, {4, 2, 0}, {width, height - 2, 1},
+        pitch, 0, pitch, 0, host.data(), 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ur_event_status_t status;
+    ASSERT_SUCCESS(urEventGetInfo(event,
+                                  UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                  sizeof(status), &status, nullptr));
+    EXPECT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+    EXPECT_EQ(host, initial);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
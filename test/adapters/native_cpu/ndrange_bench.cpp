@@ -0,0 +1,118 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the chunked parallel-for engine used by urEnqueueKernelLaunch with
+// the previous dispatch scheme, which scheduled one future per thread over a
+// vector holding one std::function per work-group. The kernel body is a
+// trivial store per work-item, so the numbers are dominated by dispatch.
+
+#include "parallel_for.hpp"
+#include "threadpool.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+void runGroup(std::vector<float> &out, size_t group, size_t localSize) {
+    for (size_t i = group * localSize; i < (group + 1) * localSize; i++) {
+        out[i] = static_cast<float>(i);
+    }
+}
+
+void launchLegacy(native_cpu::threadpool_t &tp, std::vector<float> &out,
+                  size_t numGroups, size_t localSize) {
+    std::vector<std::function<void(size_t)>> groups;
+    for (size_t g = 0; g < numGroups; g++) {
+        groups.push_back(
+            [&out, g, localSize](size_t) { runGroup(out, g, localSize); });
+    }
+    const size_t numThreads = tp.num_threads();
+    const size_t groupsPerThread = numGroups / numThreads;
+    const size_t remainder = numGroups % numThreads;
+    std::vector<std::future<void>> futures;
+    for (size_t thread = 0; thread < numThreads; thread++) {
+        futures.emplace_back(tp.schedule_task(
+            [&groups, thread, groupsPerThread](size_t threadId) {
+                for (size_t i = 0; i < groupsPerThread; i++) {
+                    groups[thread * groupsPerThread + i](threadId);
+                }
+            }));
+    }
+    if (remainder) {
+        futures.emplace_back(tp.schedule_task(
+            [&groups, remainder,
+             scheduled = numThreads * groupsPerThread](size_t threadId) {
+                for (size_t i = 0; i < remainder; i++) {
+                    groups[scheduled + i](threadId);
+                }
+            }));
+    }
+    for (auto &f : futures) {
+        f.get();
+    }
+}
+
+void launchChunked(native_cpu::threadpool_t &tp, std::vector<float> &out,
+                   size_t numGroups, size_t localSize) {
+    std::atomic<bool> done{false};
+    native_cpu::parallel_for_chunks(
+        tp, numGroups,
+        [&out, localSize](size_t, size_t begin, size_t end) {
+            for (size_t g = begin; g < end; g++) {
+                runGroup(out, g, localSize);
+            }
+        },
+        [&done]() { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+template <typename LaunchT>
+double timeLaunches(LaunchT launch, native_cpu::threadpool_t &tp,
+                    std::vector<float> &out, size_t numGroups,
+                    size_t localSize) {
+    // At least a few million work-items in total per measurement
+    const size_t numLaunches =
+        std::max<size_t>(4, (size_t{1} << 23) / (numGroups * localSize));
+    launch(tp, out, numGroups, localSize);
+    auto start = clock_type::now();
+    for (size_t i = 0; i < numLaunches; i++) {
+        launch(tp, out, numGroups, localSize);
+    }
+    auto end = clock_type::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() /
+           static_cast<double>(numLaunches);
+}
+
+} // namespace
+
+int main() {
+    native_cpu::threadpool_t tp;
+    std::printf("threads=%zu\n", tp.num_threads());
+    std::printf("%10s %8s %14s %14s %8s\n", "global", "local", "legacy us",
+                "chunked us", "speedup");
+    for (size_t globalSize :
+         {size_t{1} << 12, size_t{1} << 16, size_t{1} << 20}) {
+        std::vector<float> out(globalSize);
+        for (size_t localSize : {size_t{1}, size_t{16}, size_t{256}}) {
+            const size_t numGroups = globalSize / localSize;
+            double legacy =
+                timeLaunches(launchLegacy, tp, out, numGroups, localSize);
+            double chunked =
+                timeLaunches(launchChunked, tp, out, numGroups, localSize);
+            std::printf("%10zu %8zu %14.1f %14.1f %7.2fx\n", globalSize,
+                        localSize, legacy, chunked, legacy / chunked);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Reports the read bandwidth of every NUMA node from every node, by placing a
+// buffer on one node with first-touch and reading it from threads pinned to
+// another. Then compares parallel sweeps over a buffer on the thread pool with
+// floating workers and an allocating thread that touched everything, against
+// SYCL_NATIVE_CPU_HOST_AFFINITY=numa pinning and first-touch.
+
+#include "bulk_memory.hpp"
+#include "parallel_for.hpp"
+#include "threadpool.hpp"
+#include "topology.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t bufferSize = size_t{1} << 28;
+constexpr size_t numReps = 8;
+
+uint64_t sumRange(const uint64_t *data, size_t begin, size_t end) {
+    uint64_t sum = 0;
+    for (size_t i = begin; i < end; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+// Read bandwidth of the CPUs of `reader` over a buffer first-touched from a
+// CPU of `owner`.
+double nodeBandwidth(const native_cpu::numa_node_t &owner,
+                     const native_cpu::numa_node_t &reader) {
+    std::unique_ptr<uint64_t[]> data(new uint64_t[bufferSize / 8]);
+    std::thread([&]() {
+        native_cpu::pin_current_thread(owner.cpus[0]);
+        memset(data.get(), 1, bufferSize);
+    }).join();
+
+    const size_t numThreads = reader.cpus.size();
+    const size_t numElements = bufferSize / 8;
+    std::atomic<uint64_t> sink{0};
+    auto start = clock_type::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            native_cpu::pin_current_thread(reader.cpus[t]);
+            const size_t begin = numElements * t / numThreads;
+            const size_t end = numElements * (t + 1) / numThreads;
+            for (size_t rep = 0; rep < numReps; rep++) {
+                sink += sumRange(data.get(), begin, end);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const double seconds =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    return static_cast<double>(bufferSize * numReps) / seconds / 1e9;
+}
+
+// Bandwidth of parallel sweeps over a buffer on the thread pool, placed by
+// first-touch from the pool if it is pinned, by the calling thread otherwise.
+double poolBandwidth(bool pinned) {
+    if (pinned) {
+        ::setenv("SYCL_NATIVE_CPU_HOST_AFFINITY", "numa", 1);
+    } else {
+        ::unsetenv("SYCL_NATIVE_CPU_HOST_AFFINITY");
+    }
+    native_cpu::threadpool_t tp;
+    std::unique_ptr<uint64_t[]> data(new uint64_t[bufferSize / 8]);
+    native_cpu::bulk::firstTouch(tp, data.get(), bufferSize);
+    memset(data.get(), 1, bufferSize);
+
+    const size_t numPages = bufferSize / native_cpu::bulk::pageSize;
+    constexpr size_t perPage = native_cpu::bulk::pageSize / 8;
+    std::atomic<uint64_t> sink{0};
+    auto start = clock_type::now();
+    for (size_t rep = 0; rep < numReps; rep++) {
+        std::atomic<bool> done{false};
+        native_cpu::parallel_for_chunks(
+            tp, numPages,
+            [&](size_t, size_t begin, size_t end) {
+                sink += sumRange(data.get(), begin * perPage, end * perPage);
+            },
+            [&done]() { done.store(true, std::memory_order_release); });
+        while (!done.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    const double seconds =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    return static_cast<double>(bufferSize * numReps) / seconds / 1e9;
+}
+
+} // namespace
+
+int main() {
+    auto nodes = native_cpu::read_numa_nodes("/sys/devices/system/node",
+                                             native_cpu::allowed_cpus());
+    if (nodes.empty()) {
+        std::printf("no NUMA topology found\n");
+        return 0;
+    }
+    std::printf("read GB/s, rows: memory node, columns: CPU node\n");
+    std::printf("%8s", "");
+    for (const auto &reader : nodes) {
+        std::printf(" %8u", reader.id);
+    }
+    std::printf("\n");
+    for (const auto &owner : nodes) {
+        std::printf("%8u", owner.id);
+        for (const auto &reader : nodes) {
+            std::printf(" %8.2f", nodeBandwidth(owner, reader));
+        }
+        std::printf("\n");
+    }
+
+    std::printf("thread pool sweep, floating: %8.2f GB/s\n",
+                poolBandwidth(false));
+    std::printf("thread pool sweep, numa:     %8.2f GB/s\n",
+                poolBandwidth(true));
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "parallel_for.hpp"
+#include "threadpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(GuidedRangeTest, ClaimsEveryIndexOnce) {
+    constexpr size_t size = 10007;
+    native_cpu::guided_range_t range(size, 4, 3);
+    std::vector<int> counts(size);
+    size_t begin, end, prevChunk = size, numChunks = 0;
+    while (range.claim(begin, end)) {
+        ASSERT_LT(begin, end);
+        const size_t chunk = end - begin;
+        // Chunks shrink as the range is consumed, but not below the minimum
+        EXPECT_LE(chunk, prevChunk);
+        if (end != size) {
+            EXPECT_GE(chunk, 3u);
+        }
+        prevChunk = chunk;
+        numChunks++;
+        for (size_t i = begin; i < end; i++) {
+            counts[i]++;
+        }
+    }
+    EXPECT_FALSE(range.claim(begin, end));
+    EXPECT_LT(numChunks, size / 3);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(counts[i], 1) << "index " << i;
+    }
+}
+
+TEST(CompletionLatchTest, ReleasesOnce) {
+    native_cpu::completion_latch_t latch(3);
+    EXPECT_FALSE(latch.count_down());
+    EXPECT_FALSE(latch.count_down());
+    EXPECT_TRUE(latch.count_down());
+}
+
+template <typename T> struct ParallelForTest : ::testing::Test {};
+
+using ParallelForPoolTypes =
+    ::testing::Types<native_cpu::detail::simple_thread_pool,
+                     native_cpu::detail::work_stealing_thread_pool>;
+TYPED_TEST_SUITE(ParallelForTest, ParallelForPoolTypes);
+
+TYPED_TEST(ParallelForTest, RunsEveryIndexOnce) {
+    TypeParam pool;
+    for (size_t size : {size_t{0}, size_t{1}, size_t{7}, size_t{100000}}) {
+        std::vector<std::atomic<int>> counts(size);
+        std::atomic<int> numDone{0};
+        native_cpu::parallel_for_chunks(
+            pool, size,
+            [&counts, &pool](size_t threadId, size_t begin, size_t end) {
+                EXPECT_LT(threadId, pool.num_threads());
+                for (size_t i = begin; i < end; i++) {
+                    counts[i]++;
+                }
+            },
+            [&numDone]() { numDone++; });
+        pool.wait_for_all_pending_tasks();
+        ASSERT_EQ(numDone.load(), 1) << "size " << size;
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(counts[i].load(), 1) << "index " << i;
+        }
+    }
+}
+
+TYPED_TEST(ParallelForTest, DoneRunsAfterEveryChunk) {
+    TypeParam pool;
+    const size_t size = 4096;
+    std::atomic<size_t> processed{0};
+    std::atomic<bool> done{false};
+    native_cpu::parallel_for_chunks(
+        pool, size,
+        [&processed](size_t, size_t begin, size_t end) {
+            std::this_thread::yield();
+            processed += end - begin;
+        },
+        [&processed, &done, size]() {
+            EXPECT_EQ(processed.load(), size);
+            done = true;
+        });
+    pool.wait_for_all_pending_tasks();
+    ASSERT_TRUE(done.load());
+}
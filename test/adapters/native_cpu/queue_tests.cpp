@@ -0,0 +1,413 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+struct urNativeCpuQueueTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        size, &src));
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        size, &dst));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueFinish(queue));
+        }
+        if (src) {
+            EXPECT_SUCCESS(urUSMFree(context, src));
+        }
+        if (dst) {
+            EXPECT_SUCCESS(urUSMFree(context, dst));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    ur_event_status_t getStatus(ur_event_handle_t event) {
+        ur_event_status_t status;
+        EXPECT_SUCCESS(urEventGetInfo(event,
+                                      UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                      sizeof(status), &status, nullptr));
+        return status;
+    }
+
+    static constexpr size_t size = 1 << 20;
+    void *src = nullptr;
+    void *dst = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuQueueTest);
+
+TEST_P(urNativeCpuQueueTest, CommandsRunInOrder) {
+    const uint8_t pattern = 42;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, nullptr));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, false, dst, src, size, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    EXPECT_EQ(getStatus(event), UR_EVENT_STATUS_COMPLETE);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(static_cast<uint8_t *>(dst)[i], pattern) << "index " << i;
+    }
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuQueueTest, BlockingMemcpyCompletes) {
+    const uint8_t pattern = 7;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, true, dst, src, size, 0, nullptr, nullptr));
+    EXPECT_EQ(static_cast<uint8_t *>(dst)[0], pattern);
+    EXPECT_EQ(static_cast<uint8_t *>(dst)[size - 1], pattern);
+}
+
+TEST_P(urNativeCpuQueueTest, WaitListAcrossQueues) {
+    ur_queue_handle_t otherQueue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &otherQueue));
+
+    const uint8_t pattern = 3;
+    ur_event_handle_t fillEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, &fillEvent));
+    ur_event_handle_t copyEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(otherQueue, false, dst, src, size, 1,
+                                      &fillEvent, &copyEvent));
+    ASSERT_SUCCESS(urEventWait(1, &copyEvent));
+    EXPECT_EQ(getStatus(fillEvent), UR_EVENT_STATUS_COMPLETE);
+    EXPECT_EQ(static_cast<uint8_t *>(dst)[size - 1], pattern);
+
+    ASSERT_SUCCESS(urEventRelease(fillEvent));
+    ASSERT_SUCCESS(urEventRelease(copyEvent));
+    ASSERT_SUCCESS(urQueueRelease(otherQueue));
+}
+
+TEST_P(urNativeCpuQueueTest, EventsWaitCompletes) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+
+    ur_command_t type;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_TYPE,
+                                  sizeof(type), &type, nullptr));
+    EXPECT_EQ(type, UR_COMMAND_EVENTS_WAIT);
+    ur_queue_handle_t eventQueue = nullptr;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_QUEUE,
+                                  sizeof(eventQueue), &eventQueue, nullptr));
+    EXPECT_EQ(eventQueue, queue);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuQueueTest, CallbackRunsOnCompletion) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, false, dst, src, size, 0, nullptr, &event));
+
+    std::atomic<bool> called{false};
+    ASSERT_SUCCESS(urEventSetCallback(
+        event, UR_EXECUTION_INFO_COMPLETE,
+        [](ur_event_handle_t, ur_execution_info_t status, void *data) {
+            EXPECT_EQ(status, UR_EXECUTION_INFO_COMPLETE);
+            static_cast<std::atomic<bool> *>(data)->store(true);
+        },
+        &called));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+
+    // Callbacks may still be running on a worker thread after the wait
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!called && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(called);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuQueueTest, ReleaseQueueWithPendingCommands) {
+    ur_queue_handle_t otherQueue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &otherQueue));
+    ur_event_handle_t event = nullptr;
+    for (int i = 0; i < 16; i++) {
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(otherQueue, false, dst, src, size, 0,
+                                          nullptr, nullptr));
+    }
+    ASSERT_SUCCESS(urEnqueueEventsWait(otherQueue, 0, nullptr, &event));
+    // The pending commands keep the queue alive
+    ASSERT_SUCCESS(urQueueRelease(otherQueue));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuQueueTest, InvalidWaitList) {
+    ur_event_handle_t validEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &validEvent));
+    ur_event_handle_t nullEvent = nullptr;
+
+    // A count without a list, a list without a count and a null event
+    auto expectInvalid = [&](auto enqueue) {
+        EXPECT_EQ(enqueue(1, nullptr), UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+        EXPECT_EQ(enqueue(0, &validEvent),
+                  UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+        EXPECT_EQ(enqueue(1, &nullEvent),
+                  UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    };
+
+    const uint8_t pattern = 1;
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        return urEnqueueEventsWait(queue, count, list, nullptr);
+    });
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        return urEnqueueEventsWaitWithBarrier(queue, count, list, nullptr);
+    });
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        return urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern, size,
+                                count, list, nullptr);
+    });
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        return urEnqueueUSMMemcpy(queue, true, dst, src, size, count, list,
+                                  nullptr);
+    });
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        return urEnqueueUSMMemcpy2D(queue, true, dst, 64, src, 64, 64, 4,
+                                    count, list, nullptr);
+    });
+    expectInvalid([&](uint32_t count, const ur_event_handle_t *list) {
+        ur_event_handle_t event = nullptr;
+        auto result =
+            urEnqueueTimestampRecordingExp(queue, true, count, list, &event);
+        if (event) {
+            urEventRelease(event);
+        }
+        return result;
+    });
+
+    ASSERT_SUCCESS(urEventRelease(validEvent));
+}
+
+struct urNativeCpuOutOfOrderQueueTest : urNativeCpuQueueTest {
+    void SetUp() override {
+        queue_properties.flags = UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+        UUR_RETURN_ON_FATAL_FAILURE(urNativeCpuQueueTest::SetUp());
+    }
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuOutOfOrderQueueTest);
+
+TEST_P(urNativeCpuOutOfOrderQueueTest, GetFlags) {
+    ur_queue_flags_t flags = 0;
+    ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_FLAGS, sizeof(flags),
+                                  &flags, nullptr));
+    EXPECT_TRUE(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+}
+
+TEST_P(urNativeCpuOutOfOrderQueueTest, WaitListOrdersCommands) {
+    const uint8_t pattern = 11;
+    ur_event_handle_t fillEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, &fillEvent));
+    ur_event_handle_t copyEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, size, 1,
+                                      &fillEvent, &copyEvent));
+    ASSERT_SUCCESS(urEventWait(1, &copyEvent));
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(static_cast<uint8_t *>(dst)[i], pattern) << "index " << i;
+    }
+    ASSERT_SUCCESS(urEventRelease(fillEvent));
+    ASSERT_SUCCESS(urEventRelease(copyEvent));
+}
+
+TEST_P(urNativeCpuOutOfOrderQueueTest, BarrierOrdersCommands) {
+    const uint8_t pattern = 12;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(
+        urEnqueueEventsWaitWithBarrier(queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, true, dst, src, size, 0, nullptr, nullptr));
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(static_cast<uint8_t *>(dst)[i], pattern) << "index " << i;
+    }
+}
+
+TEST_P(urNativeCpuOutOfOrderQueueTest, EventsWaitWaitsForAll) {
+    // Independent commands, each copying its own slice
+    std::vector<ur_event_handle_t> events(8);
+    const size_t slice = size / events.size();
+    for (size_t i = 0; i < events.size(); i++) {
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(
+            queue, false, static_cast<uint8_t *>(dst) + i * slice,
+            static_cast<uint8_t *>(src) + i * slice, slice, 0, nullptr,
+            &events[i]));
+    }
+    ur_event_handle_t waitEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &waitEvent));
+    ASSERT_SUCCESS(urEventWait(1, &waitEvent));
+    for (auto event : events) {
+        EXPECT_EQ(getStatus(event), UR_EVENT_STATUS_COMPLETE);
+        ASSERT_SUCCESS(urEventRelease(event));
+    }
+    ASSERT_SUCCESS(urEventRelease(waitEvent));
+}
+
+TEST_P(urNativeCpuOutOfOrderQueueTest, IndependentCommandsOverlap) {
+    uint32_t computeUnits = 0;
+    ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_MAX_COMPUTE_UNITS,
+                                   sizeof(computeUnits), &computeUnits,
+                                   nullptr));
+    if (computeUnits < 2) {
+        GTEST_SKIP() << "needs at least two worker threads";
+    }
+
+    // Hold the first command in its RUNNING callback until the second,
+    // independent, command has completed.
+    struct gate_t {
+        std::thread::id testThread = std::this_thread::get_id();
+        std::atomic<bool> open{false};
+    } gate;
+    ur_event_handle_t blocked = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, size / 2, 0,
+                                      nullptr, &blocked));
+    ASSERT_SUCCESS(urEventSetCallback(
+        blocked, UR_EXECUTION_INFO_RUNNING,
+        [](ur_event_handle_t, ur_execution_info_t, void *data) {
+            auto gate = static_cast<gate_t *>(data);
+            // The command may already be running when the callback is set
+            if (std::this_thread::get_id() == gate->testThread) {
+                return;
+            }
+            while (!gate->open) {
+                std::this_thread::yield();
+            }
+        },
+        &gate));
+
+    ur_event_handle_t independent = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(
+        queue, false, static_cast<uint8_t *>(dst) + size / 2,
+        static_cast<uint8_t *>(src) + size / 2, size / 2, 0, nullptr,
+        &independent));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (getStatus(independent) != UR_EVENT_STATUS_COMPLETE &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(getStatus(independent), UR_EVENT_STATUS_COMPLETE);
+    gate.open = true;
+
+    ASSERT_SUCCESS(urEventWait(1, &blocked));
+    ASSERT_SUCCESS(urEventRelease(blocked));
+    ASSERT_SUCCESS(urEventRelease(independent));
+}
+
+TEST_P(urNativeCpuQueueTest, ProfilingInfoNotAvailable) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, true, dst, src, size, 0, nullptr, &event));
+    uint64_t time = 0;
+    EXPECT_EQ(urEventGetProfilingInfo(event, UR_PROFILING_INFO_COMMAND_START,
+                                      sizeof(time), &time, nullptr),
+              UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+struct urNativeCpuProfilingQueueTest : urNativeCpuQueueTest {
+    void SetUp() override {
+        queue_properties.flags = UR_QUEUE_FLAG_PROFILING_ENABLE;
+        UUR_RETURN_ON_FATAL_FAILURE(urNativeCpuQueueTest::SetUp());
+    }
+
+    uint64_t getTime(ur_event_handle_t event, ur_profiling_info_t info) {
+        uint64_t time = 0;
+        EXPECT_SUCCESS(urEventGetProfilingInfo(event, info, sizeof(time),
+                                               &time, nullptr));
+        return time;
+    }
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuProfilingQueueTest);
+
+TEST_P(urNativeCpuProfilingQueueTest, TimestampsAreOrdered) {
+    uint64_t before = 0;
+    ASSERT_SUCCESS(urDeviceGetGlobalTimestamps(device, &before, nullptr));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, false, dst, src, size, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    uint64_t after = 0;
+    ASSERT_SUCCESS(urDeviceGetGlobalTimestamps(device, &after, nullptr));
+
+    const uint64_t queued = getTime(event, UR_PROFILING_INFO_COMMAND_QUEUED);
+    const uint64_t submit = getTime(event, UR_PROFILING_INFO_COMMAND_SUBMIT);
+    const uint64_t start = getTime(event, UR_PROFILING_INFO_COMMAND_START);
+    const uint64_t end = getTime(event, UR_PROFILING_INFO_COMMAND_END);
+    EXPECT_LE(before, queued);
+    EXPECT_LE(queued, submit);
+    EXPECT_LE(submit, start);
+    EXPECT_LE(start, end);
+    EXPECT_LE(end, after);
+    EXPECT_EQ(getTime(event, UR_PROFILING_INFO_COMMAND_COMPLETE), end);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urNativeCpuProfilingQueueTest, SubmittedAfterDependencies) {
+    ur_queue_handle_t otherQueue = nullptr;
+    ASSERT_SUCCESS(
+        urQueueCreate(context, device, &queue_properties, &otherQueue));
+    ur_event_handle_t first = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(otherQueue, false, dst, src, size, 0,
+                                      nullptr, &first));
+    ur_event_handle_t second = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, src, dst, size, 1, &first,
+                                      &second));
+    ASSERT_SUCCESS(urEventWait(1, &second));
+    EXPECT_LE(getTime(first, UR_PROFILING_INFO_COMMAND_END),
+              getTime(second, UR_PROFILING_INFO_COMMAND_SUBMIT));
+    EXPECT_LE(getTime(second, UR_PROFILING_INFO_COMMAND_QUEUED),
+              getTime(second, UR_PROFILING_INFO_COMMAND_SUBMIT));
+    ASSERT_SUCCESS(urEventRelease(first));
+    ASSERT_SUCCESS(urEventRelease(second));
+    ASSERT_SUCCESS(urQueueRelease(otherQueue));
+}
+
+TEST_P(urNativeCpuProfilingQueueTest, TimestampRecording) {
+    bool supported = false;
+    ASSERT_SUCCESS(urDeviceGetInfo(
+        device, UR_DEVICE_INFO_TIMESTAMP_RECORDING_SUPPORT_EXP,
+        sizeof(supported), &supported, nullptr));
+    ASSERT_TRUE(supported);
+
+    ur_event_handle_t copy = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMMemcpy(queue, false, dst, src, size, 0, nullptr, &copy));
+    ur_event_handle_t timestamp = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueTimestampRecordingExp(queue, true, 0, nullptr, &timestamp));
+    const uint64_t start =
+        getTime(timestamp, UR_PROFILING_INFO_COMMAND_START);
+    EXPECT_EQ(getTime(timestamp, UR_PROFILING_INFO_COMMAND_END), start);
+    EXPECT_EQ(getTime(timestamp, UR_PROFILING_INFO_COMMAND_SUBMIT),
+              getTime(timestamp, UR_PROFILING_INFO_COMMAND_QUEUED));
+    // Recorded once the previous command has completed
+    EXPECT_LE(getTime(copy, UR_PROFILING_INFO_COMMAND_END), start);
+    ASSERT_SUCCESS(urEventRelease(copy));
+    ASSERT_SUCCESS(urEventRelease(timestamp));
+}
+
+TEST_P(urNativeCpuQueueTest, TimestampRecordingWithoutProfiling) {
+    ur_event_handle_t timestamp = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueTimestampRecordingExp(queue, false, 0, nullptr, &timestamp));
+    ASSERT_SUCCESS(urEventWait(1, &timestamp));
+    uint64_t time = 0;
+    ASSERT_SUCCESS(urEventGetProfilingInfo(timestamp,
+                                           UR_PROFILING_INFO_COMMAND_END,
+                                           sizeof(time), &time, nullptr));
+    EXPECT_NE(time, 0u);
+    ASSERT_SUCCESS(urEventRelease(timestamp));
+}
@@ -0,0 +1,48 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the scheduling throughput of the native_cpu thread pools by
+// submitting batches of near-empty tasks, which is what launches with many
+// small work-groups look like to the pool.
+
+#include "threadpool.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+template <typename PoolT>
+static double runBatches(PoolT &pool, size_t numBatches, size_t tasksPerBatch) {
+    std::atomic<size_t> sink{0};
+    auto start = std::chrono::steady_clock::now();
+    for (size_t b = 0; b < numBatches; b++) {
+        for (size_t t = 0; t < tasksPerBatch; t++) {
+            pool.schedule([&sink](size_t threadId) {
+                sink.fetch_add(threadId, std::memory_order_relaxed);
+            });
+        }
+        pool.wait_for_all_pending_tasks();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           static_cast<double>(numBatches * tasksPerBatch);
+}
+
+template <typename PoolT> static void benchPool(const char *name) {
+    PoolT pool;
+    // Warm up so that thread creation is not measured
+    runBatches(pool, 10, pool.num_threads());
+    for (size_t tasksPerBatch : {size_t{16}, size_t{256}, size_t{4096}}) {
+        const size_t numBatches = 65536 / tasksPerBatch;
+        double nsPerTask = runBatches(pool, numBatches, tasksPerBatch);
+        std::printf("%-14s threads=%-4zu tasks/batch=%-6zu %10.1f ns/task\n",
+                    name, pool.num_threads(), tasksPerBatch, nsPerTask);
+    }
+}
+
+int main() {
+    benchPool<native_cpu::detail::simple_thread_pool>("simple");
+    benchPool<native_cpu::detail::work_stealing_thread_pool>("work_stealing");
+    return 0;
+}
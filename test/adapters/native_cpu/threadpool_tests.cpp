@@ -0,0 +1,231 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "threadpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <set>
+
+template <typename T> struct ThreadPoolTest : ::testing::Test {};
+
+using ThreadPoolTypes =
+    ::testing::Types<native_cpu::detail::simple_thread_pool,
+                     native_cpu::detail::work_stealing_thread_pool>;
+TYPED_TEST_SUITE(ThreadPoolTest, ThreadPoolTypes);
+
+TYPED_TEST(ThreadPoolTest, RunsEveryTaskOnce) {
+    constexpr size_t numTasks = 10000;
+    std::vector<std::atomic<int>> counts(numTasks);
+    TypeParam pool;
+    for (size_t i = 0; i < numTasks; i++) {
+        pool.schedule([&counts, i](size_t) { counts[i]++; });
+    }
+    pool.wait_for_all_pending_tasks();
+    for (size_t i = 0; i < numTasks; i++) {
+        ASSERT_EQ(counts[i].load(), 1) << "task " << i;
+    }
+}
+
+TYPED_TEST(ThreadPoolTest, ThreadIdsAreInRange) {
+    TypeParam pool;
+    std::atomic<size_t> maxId{0};
+    for (size_t i = 0; i < 1000; i++) {
+        pool.schedule([&maxId](size_t threadId) {
+            size_t prev = maxId.load();
+            while (prev < threadId &&
+                   !maxId.compare_exchange_weak(prev, threadId)) {
+            }
+        });
+    }
+    pool.wait_for_all_pending_tasks();
+    ASSERT_LT(maxId.load(), pool.num_threads());
+}
+
+TYPED_TEST(ThreadPoolTest, NestedScheduling) {
+    constexpr size_t numOuter = 64;
+    constexpr size_t numInner = 64;
+    std::atomic<size_t> count{0};
+    TypeParam pool;
+    for (size_t i = 0; i < numOuter; i++) {
+        pool.schedule([&](size_t) {
+            for (size_t j = 0; j < numInner; j++) {
+                pool.schedule([&](size_t) { count++; });
+            }
+        });
+    }
+    pool.wait_for_all_pending_tasks();
+    ASSERT_EQ(count.load(), numOuter * numInner);
+}
+
+TYPED_TEST(ThreadPoolTest, DestructorDrainsPendingTasks) {
+    std::atomic<size_t> count{0};
+    {
+        TypeParam pool;
+        for (size_t i = 0; i < 1000; i++) {
+            pool.schedule([&count](size_t) { count++; });
+        }
+    }
+    ASSERT_EQ(count.load(), 1000u);
+}
+
+TYPED_TEST(ThreadPoolTest, ParkedWorkersWakeUp) {
+    TypeParam pool;
+    std::atomic<size_t> count{0};
+    for (size_t round = 0; round < 10; round++) {
+        // Give the workers time to go idle between rounds
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        pool.schedule([&count](size_t) { count++; });
+        pool.wait_for_all_pending_tasks();
+        ASSERT_EQ(count.load(), round + 1);
+    }
+}
+
+TYPED_TEST(ThreadPoolTest, EveryWaitPolicy) {
+    using mode_t = native_cpu::detail::wait_policy_t::mode_t;
+    for (auto mode : {mode_t::park, mode_t::spin, mode_t::adaptive}) {
+        native_cpu::detail::wait_policy_t policy;
+        policy.mode = mode;
+        TypeParam pool(native_cpu::worker_placement_t(4), policy);
+        std::atomic<size_t> count{0};
+        for (size_t round = 0; round < 20; round++) {
+            // Alternate between catching the workers spinning and parked
+            std::this_thread::sleep_for(std::chrono::microseconds(
+                round % 2 ? 10 : 2 * policy.spinTime.count() / 1000));
+            for (size_t i = 0; i < 8; i++) {
+                pool.schedule([&count](size_t) { count++; });
+            }
+            pool.wait_for_all_pending_tasks();
+            ASSERT_EQ(count.load(), (round + 1) * 8);
+        }
+    }
+}
+
+TEST(WaitPolicyTest, Parses) {
+    using native_cpu::detail::wait_policy_t;
+    using namespace std::chrono_literals;
+    EXPECT_EQ(wait_policy_t::parse(nullptr).mode,
+              wait_policy_t::mode_t::adaptive);
+    EXPECT_EQ(wait_policy_t::parse(nullptr).spinTime,
+              wait_policy_t::defaultSpinTime);
+    EXPECT_EQ(wait_policy_t::parse("park").mode, wait_policy_t::mode_t::park);
+    EXPECT_EQ(wait_policy_t::parse("spin").mode, wait_policy_t::mode_t::spin);
+
+    auto policy = wait_policy_t::parse("spin:200");
+    EXPECT_EQ(policy.mode, wait_policy_t::mode_t::spin);
+    EXPECT_EQ(policy.spinTime, 200us);
+    policy = wait_policy_t::parse("adaptive:0");
+    EXPECT_EQ(policy.mode, wait_policy_t::mode_t::adaptive);
+    EXPECT_EQ(policy.spinTime, 0us);
+    EXPECT_EQ(wait_policy_t::parse("spin:99999999").spinTime,
+              wait_policy_t::maxSpinTime);
+
+    // Malformed policies fall back to the default
+    for (const char *text : {"", "sleep", "spin:", "spin:10us", ":10"}) {
+        policy = wait_policy_t::parse(text);
+        EXPECT_EQ(policy.mode, wait_policy_t::mode_t::adaptive) << text;
+        EXPECT_EQ(policy.spinTime, wait_policy_t::defaultSpinTime) << text;
+    }
+}
+
+TEST(IdleWaiterTest, SpinsForTheBudget) {
+    using native_cpu::detail::wait_policy_t;
+    using clock_type = native_cpu::detail::idle_waiter_t::clock_type;
+    wait_policy_t policy;
+    policy.mode = wait_policy_t::mode_t::spin;
+    policy.spinTime = std::chrono::microseconds(200);
+    native_cpu::detail::idle_waiter_t spinning(policy);
+    EXPECT_EQ(spinning.spin_budget(), policy.spinTime);
+    auto start = clock_type::now();
+    EXPECT_FALSE(spinning.spin([]() { return false; }));
+    EXPECT_GE(clock_type::now() - start, policy.spinTime);
+    size_t polls = 0;
+    EXPECT_TRUE(spinning.spin([&polls]() { return ++polls == 100; }));
+
+    policy.mode = wait_policy_t::mode_t::park;
+    native_cpu::detail::idle_waiter_t parking(policy);
+    EXPECT_EQ(parking.spin_budget().count(), 0);
+    polls = 0;
+    EXPECT_FALSE(parking.spin([&polls]() { return ++polls > 1; }));
+    EXPECT_EQ(polls, 1u);
+}
+
+TEST(IdleWaiterTest, AdaptsToIdleTime) {
+    using native_cpu::detail::wait_policy_t;
+    wait_policy_t policy;
+    policy.spinTime = std::chrono::microseconds(50);
+    native_cpu::detail::idle_waiter_t waiter(policy);
+    EXPECT_EQ(waiter.spin_budget(), policy.spinTime);
+
+    // Tasks that come further apart than the spin time stop the spinning
+    for (int i = 0; i < 32; i++) {
+        waiter.spin([]() { return true; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        waiter.found_work();
+    }
+    EXPECT_EQ(waiter.spin_budget().count(), 0);
+
+    // And tasks that follow each other closely bring it back
+    for (int i = 0; i < 64; i++) {
+        waiter.spin([]() { return true; });
+        waiter.found_work();
+    }
+    EXPECT_GT(waiter.spin_budget().count(), 0);
+    EXPECT_LT(waiter.spin_budget(), policy.spinTime);
+}
+
+TEST(ThreadPoolInterfaceTest, FuturesComplete) {
+    native_cpu::threadpool_t tp;
+    std::atomic<size_t> count{0};
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < 100; i++) {
+        futures.emplace_back(tp.schedule_task([&count](size_t) { count++; }));
+    }
+    for (auto &f : futures) {
+        f.get();
+    }
+    ASSERT_EQ(count.load(), 100u);
+}
+
+TEST(LocalArenaTest, AlignedAndGrows) {
+    native_cpu::local_arena_t arena;
+    void *small = arena.get(10);
+    ASSERT_NE(small, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small) %
+                  native_cpu::local_arena_t::alignment,
+              0u);
+    // Smaller requests reuse the buffer
+    EXPECT_EQ(arena.get(1), small);
+    void *large = arena.get(1 << 20);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large) %
+                  native_cpu::local_arena_t::alignment,
+              0u);
+    std::memset(large, 0, 1 << 20);
+    EXPECT_EQ(arena.get(1 << 19), large);
+}
+
+TEST(ThreadPoolInterfaceTest, ArenaPerWorker) {
+    native_cpu::threadpool_t tp;
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < 100; i++) {
+        futures.emplace_back(tp.schedule_task([&tp](size_t threadId) {
+            auto *data = static_cast<size_t *>(
+                tp.local_arena(threadId).get(64 * sizeof(size_t)));
+            for (size_t j = 0; j < 64; j++) {
+                data[j] = threadId;
+            }
+            for (size_t j = 0; j < 64; j++) {
+                ASSERT_EQ(data[j], threadId);
+            }
+        }));
+    }
+    for (auto &f : futures) {
+        f.get();
+    }
+}
@@ -0,0 +1,246 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "parallel_for.hpp"
+#include "threadpool.hpp"
+#include "topology.hpp"
+
+#include "ur_filesystem_resolved.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace fs = filesystem;
+
+TEST(TopologyTest, ParseCpuList) {
+    using list_t = std::vector<unsigned>;
+    EXPECT_EQ(native_cpu::parse_cpu_list("0-3,8,10-11\n"),
+              (list_t{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(native_cpu::parse_cpu_list("5"), (list_t{5}));
+    EXPECT_EQ(native_cpu::parse_cpu_list("4,0-1,1"), (list_t{0, 1, 4}));
+    EXPECT_EQ(native_cpu::parse_cpu_list(""), list_t{});
+    // Malformed entries end the list
+    EXPECT_EQ(native_cpu::parse_cpu_list("0-1,x,4"), (list_t{0, 1}));
+    EXPECT_EQ(native_cpu::parse_cpu_list("3-1"), list_t{});
+}
+
+struct TopologySysfsTest : ::testing::Test {
+    void SetUp() override {
+        dir = fs::temp_directory_path() /
+              ("ur_native_cpu_topology_" + std::to_string(::getpid()));
+        fs::create_directories(dir);
+    }
+
+    void TearDown() override { fs::remove_all(dir); }
+
+    void write(const std::string &path, const std::string &contents) {
+        fs::create_directories((dir / path).parent_path());
+        std::ofstream(dir / path) << contents << "\n";
+    }
+
+    fs::path dir;
+};
+
+TEST_F(TopologySysfsTest, ReadsNodes) {
+    write("online", "0-2");
+    write("node0/cpulist", "0-3");
+    write("node1/cpulist", "4-7");
+    // Memory-only node
+    write("node2/cpulist", "");
+
+    auto nodes = native_cpu::read_numa_nodes(dir.string(), {});
+    ASSERT_EQ(nodes.size(), 2u);
+    EXPECT_EQ(nodes[0].id, 0u);
+    EXPECT_EQ(nodes[0].cpus, (std::vector<unsigned>{0, 1, 2, 3}));
+    EXPECT_EQ(nodes[1].id, 1u);
+    EXPECT_EQ(nodes[1].cpus, (std::vector<unsigned>{4, 5, 6, 7}));
+
+    // CPUs outside of the affinity mask are dropped, and so are nodes left
+    // without any
+    nodes = native_cpu::read_numa_nodes(dir.string(), {1, 3});
+    ASSERT_EQ(nodes.size(), 1u);
+    EXPECT_EQ(nodes[0].cpus, (std::vector<unsigned>{1, 3}));
+}
+
+TEST_F(TopologySysfsTest, MissingTopology) {
+    EXPECT_TRUE(
+        native_cpu::read_numa_nodes((dir / "missing").string(), {}).empty());
+}
+
+TEST(TopologyTest, ParseSize) {
+    EXPECT_EQ(native_cpu::parse_size("48K\n"), 48u << 10);
+    EXPECT_EQ(native_cpu::parse_size("2M"), 2u << 20);
+    EXPECT_EQ(native_cpu::parse_size("       16384 kB"), 16384u << 10);
+    EXPECT_EQ(native_cpu::parse_size("64"), 64u);
+    EXPECT_EQ(native_cpu::parse_size("none"), 0u);
+}
+
+TEST_F(TopologySysfsTest, ReadsMeminfo) {
+    write("meminfo", "MemTotal:       16384 kB\n"
+                     "MemFree:         1024 kB\n"
+                     "MemAvailable:    4096 kB");
+    const std::string path = (dir / "meminfo").string();
+    EXPECT_EQ(native_cpu::read_meminfo(path, "MemTotal"), 16384u << 10);
+    EXPECT_EQ(native_cpu::read_meminfo(path, "MemAvailable"), 4096u << 10);
+    // Prefixes of other keys don't match
+    EXPECT_EQ(native_cpu::read_meminfo(path, "Mem"), 0u);
+    EXPECT_EQ(native_cpu::read_meminfo((dir / "missing").string(), "MemTotal"),
+              0u);
+}
+
+TEST_F(TopologySysfsTest, ReadsCaches) {
+    const std::string levels[] = {"2", "1", "1", "3"};
+    const std::string types[] = {"Unified", "Data", "Instruction", "Unified"};
+    const std::string sizes[] = {"2048K", "48K", "32K", "30M"};
+    for (size_t i = 0; i < 4; i++) {
+        const std::string index = "index" + std::to_string(i);
+        write(index + "/level", levels[i]);
+        write(index + "/type", types[i]);
+        write(index + "/size", sizes[i]);
+        write(index + "/coherency_line_size", "64");
+    }
+
+    auto caches = native_cpu::read_caches(dir.string());
+    ASSERT_EQ(caches.size(), 3u);
+    EXPECT_EQ(caches[0].level, 1u);
+    EXPECT_EQ(caches[0].size, 48u << 10);
+    EXPECT_EQ(caches[0].lineSize, 64u);
+    EXPECT_EQ(caches[1].size, 2u << 20);
+    EXPECT_EQ(caches[2].size, 30u << 20);
+
+    native_cpu::host_info_t info;
+    info.caches = caches;
+    EXPECT_EQ(info.cache_size(2), 2u << 20);
+    EXPECT_EQ(info.cache_size(4), 0u);
+    EXPECT_EQ(info.last_level_cache_size(), 30u << 20);
+    EXPECT_EQ(info.cache_line_size(), 64u);
+
+    EXPECT_TRUE(native_cpu::read_caches((dir / "missing").string()).empty());
+}
+
+TEST(WorkerPlacementTest, Floating) {
+    native_cpu::worker_placement_t placement(6);
+    EXPECT_FALSE(placement.is_pinned());
+    EXPECT_EQ(placement.num_nodes(), 1u);
+    EXPECT_EQ(placement.num_node_workers(0), 6u);
+    EXPECT_EQ(placement.node_of(5), 0u);
+}
+
+TEST(WorkerPlacementTest, SpreadsWorkersOverNodes) {
+    const std::vector<native_cpu::numa_node_t> nodes{{0, {0, 1, 2, 3}},
+                                                     {1, {8, 9, 10, 11}}};
+    native_cpu::worker_placement_t placement(nodes, 4);
+    ASSERT_TRUE(placement.is_pinned());
+    ASSERT_EQ(placement.num_nodes(), 2u);
+    EXPECT_EQ(placement.num_node_workers(0), 2u);
+    EXPECT_EQ(placement.num_node_workers(1), 2u);
+    const unsigned expectedCpus[] = {0, 2, 8, 10};
+    const size_t expectedNodes[] = {0, 0, 1, 1};
+    for (size_t worker = 0; worker < 4; worker++) {
+        EXPECT_EQ(placement.cpu_of(worker), expectedCpus[worker]);
+        EXPECT_EQ(placement.node_of(worker), expectedNodes[worker]);
+    }
+
+    // More workers than CPUs share them
+    placement = native_cpu::worker_placement_t(nodes, 12);
+    EXPECT_EQ(placement.num_node_workers(0), 6u);
+    EXPECT_EQ(placement.num_node_workers(1), 6u);
+    EXPECT_EQ(placement.cpu_of(11), 11u);
+
+    // Nodes without workers are dropped
+    placement = native_cpu::worker_placement_t(nodes, 1);
+    EXPECT_EQ(placement.num_nodes(), 1u);
+    EXPECT_EQ(placement.cpu_of(0), 0u);
+}
+
+TEST(WorkerPlacementTest, WorkerNodes) {
+    const std::vector<native_cpu::numa_node_t> nodes{{0, {0, 1}},
+                                                     {3, {4, 5}}};
+    auto units = native_cpu::worker_placement_t(nodes, 2).worker_nodes();
+    ASSERT_EQ(units.size(), 2u);
+    EXPECT_EQ(units[0].id, 0u);
+    EXPECT_EQ(units[0].cpus, (std::vector<unsigned>{0}));
+    EXPECT_EQ(units[1].id, 3u);
+    EXPECT_EQ(units[1].cpus, (std::vector<unsigned>{4}));
+
+    // More workers than CPUs share them
+    native_cpu::worker_placement_t placement(nodes, 8);
+    units = placement.worker_nodes();
+    ASSERT_EQ(units.size(), 2u);
+    std::vector<unsigned> cpus = units[0].cpus;
+    cpus.insert(cpus.end(), units[1].cpus.begin(), units[1].cpus.end());
+    ASSERT_EQ(cpus.size(), 8u);
+    for (size_t worker = 0; worker < 8; worker++) {
+        EXPECT_EQ(cpus[worker], placement.cpu_of(worker));
+    }
+
+    // Floating workers are numbered
+    units = native_cpu::worker_placement_t(3).worker_nodes();
+    ASSERT_EQ(units.size(), 1u);
+    EXPECT_EQ(units[0].cpus, (std::vector<unsigned>{0, 1, 2}));
+}
+
+TEST(NodeRangesTest, PrefersOwnNode) {
+    const std::vector<native_cpu::numa_node_t> nodes{{0, {0, 1}},
+                                                     {1, {2, 3, 4, 5}}};
+    native_cpu::worker_placement_t placement(nodes, 6);
+    constexpr size_t size = 3000;
+    native_cpu::node_ranges_t ranges(size, 6, placement);
+    std::vector<int> counts(size);
+    size_t begin, end;
+
+    // Node 1 has two thirds of the workers, so it owns the last two thirds
+    // of the range, and only helps node 0 once that is done.
+    size_t claimed = 0;
+    while (claimed < 2000) {
+        ASSERT_TRUE(ranges.claim(1, begin, end));
+        EXPECT_GE(begin, 1000u);
+        for (size_t i = begin; i < end; i++) {
+            counts[i]++;
+        }
+        claimed += end - begin;
+    }
+    while (ranges.claim(1, begin, end)) {
+        EXPECT_LE(end, 1000u);
+        for (size_t i = begin; i < end; i++) {
+            counts[i]++;
+        }
+    }
+    EXPECT_FALSE(ranges.claim(0, begin, end));
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(counts[i], 1) << "index " << i;
+    }
+}
+
+TEST(NodeRangesTest, PinnedPool) {
+    // Whatever the host looks like, a pinned pool runs every index once.
+    ::setenv("SYCL_NATIVE_CPU_HOST_AFFINITY", "numa", 1);
+    native_cpu::detail::work_stealing_thread_pool pool;
+    ::unsetenv("SYCL_NATIVE_CPU_HOST_AFFINITY");
+    EXPECT_TRUE(pool.placement().is_pinned());
+
+    constexpr size_t size = 100000;
+    std::vector<std::atomic<int>> counts(size);
+    std::atomic<bool> done{false};
+    native_cpu::parallel_for_chunks(
+        pool, size,
+        [&counts](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                counts[i]++;
+            }
+        },
+        [&done]() { done = true; });
+    pool.wait_for_all_pending_tasks();
+    EXPECT_TRUE(done);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(counts[i], 1) << "index " << i;
+    }
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using urNativeCpuUSMTest = uur::urContextTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuUSMTest);
+
+TEST_P(urNativeCpuUSMTest, AlignmentIsHonoured) {
+    for (uint32_t align : {8u, 64u, 256u, 4096u, 65536u}) {
+        for (size_t size : {size_t{1}, size_t{100}, size_t{1} << 20}) {
+            ur_usm_desc_t desc{UR_STRUCTURE_TYPE_USM_DESC, nullptr, 0, align};
+            void *ptrs[3] = {};
+            ASSERT_SUCCESS(
+                urUSMHostAlloc(context, &desc, nullptr, size, &ptrs[0]));
+            ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, &desc, nullptr,
+                                            size, &ptrs[1]));
+            ASSERT_SUCCESS(urUSMSharedAlloc(context, device, &desc, nullptr,
+                                            size, &ptrs[2]));
+            for (auto ptr : ptrs) {
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % align, 0u)
+                    << "align " << align << " size " << size;
+                static_cast<char *>(ptr)[size - 1] = 1;
+                ASSERT_SUCCESS(urUSMFree(context, ptr));
+            }
+        }
+    }
+}
+
+TEST_P(urNativeCpuUSMTest, InvalidAlignment) {
+    ur_usm_desc_t desc{UR_STRUCTURE_TYPE_USM_DESC, nullptr, 0, 3};
+    void *ptr = nullptr;
+    ASSERT_EQ(urUSMHostAlloc(context, &desc, nullptr, 64, &ptr),
+              UR_RESULT_ERROR_INVALID_VALUE);
+}
+
+TEST_P(urNativeCpuUSMTest, ReusesFreedAllocations) {
+    // Small allocations are served from the pool, so allocating and freeing
+    // repeatedly must not leak or hand out overlapping blocks.
+    std::vector<void *> ptrs(256);
+    for (int round = 0; round < 4; round++) {
+        for (size_t i = 0; i < ptrs.size(); i++) {
+            ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                                            64, &ptrs[i]));
+            std::fill_n(static_cast<char *>(ptrs[i]), 64, char(i));
+        }
+        for (size_t i = 0; i < ptrs.size(); i++) {
+            ASSERT_EQ(static_cast<char *>(ptrs[i])[63], char(i));
+            ASSERT_SUCCESS(urUSMFree(context, ptrs[i]));
+        }
+    }
+}
+
+TEST_P(urNativeCpuUSMTest, AllocInfo) {
+    constexpr size_t size = 1000;
+    void *host = nullptr, *shared = nullptr;
+    ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, nullptr, size, &host));
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, nullptr, size, &shared));
+
+    for (auto [ptr, type] : {std::pair{host, UR_USM_TYPE_HOST},
+                             std::pair{shared, UR_USM_TYPE_SHARED}}) {
+        // Any pointer into the allocation resolves to it
+        for (size_t offset : {size_t{0}, size_t{1}, size - 1}) {
+            const void *query = static_cast<char *>(ptr) + offset;
+            ur_usm_type_t allocType = UR_USM_TYPE_UNKNOWN;
+            ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, query,
+                                                UR_USM_ALLOC_INFO_TYPE,
+                                                sizeof(allocType), &allocType,
+                                                nullptr));
+            EXPECT_EQ(allocType, type);
+            void *base = nullptr;
+            ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, query,
+                                                UR_USM_ALLOC_INFO_BASE_PTR,
+                                                sizeof(base), &base, nullptr));
+            EXPECT_EQ(base, ptr);
+            size_t allocSize = 0;
+            ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, query,
+                                                UR_USM_ALLOC_INFO_SIZE,
+                                                sizeof(allocSize), &allocSize,
+                                                nullptr));
+            EXPECT_EQ(allocSize, size);
+        }
+    }
+
+    ur_device_handle_t allocDevice = nullptr;
+    ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, shared,
+                                        UR_USM_ALLOC_INFO_DEVICE,
+                                        sizeof(allocDevice), &allocDevice,
+                                        nullptr));
+    EXPECT_EQ(allocDevice, device);
+
+    ASSERT_SUCCESS(urUSMFree(context, host));
+    ASSERT_SUCCESS(urUSMFree(context, shared));
+
+    // Pointers outside any live allocation are unknown
+    int local = 0;
+    for (const void *ptr : {static_cast<const void *>(&local),
+                            static_cast<const void *>(shared)}) {
+        ur_usm_type_t allocType = UR_USM_TYPE_HOST;
+        ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, ptr,
+                                            UR_USM_ALLOC_INFO_TYPE,
+                                            sizeof(allocType), &allocType,
+                                            nullptr));
+        EXPECT_EQ(allocType, UR_USM_TYPE_UNKNOWN);
+        size_t allocSize = 0;
+        ASSERT_EQ(urUSMGetMemAllocInfo(context, ptr, UR_USM_ALLOC_INFO_SIZE,
+                                       sizeof(allocSize), &allocSize, nullptr),
+                  UR_RESULT_ERROR_INVALID_VALUE);
+    }
+}
+
+struct urNativeCpuUSMPoolTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::SetUp());
+        ur_usm_pool_desc_t desc{UR_STRUCTURE_TYPE_USM_POOL_DESC, nullptr,
+                                UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK};
+        auto ret = urUSMPoolCreate(context, &desc, &pool);
+        if (ret == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+            GTEST_SKIP() << "USM pools are not supported";
+        }
+        ASSERT_SUCCESS(ret);
+    }
+
+    void TearDown() override {
+        if (pool) {
+            EXPECT_SUCCESS(urUSMPoolRelease(pool));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    ur_usm_pool_handle_t pool = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuUSMPoolTest);
+
+TEST_P(urNativeCpuUSMPoolTest, GetInfo) {
+    ASSERT_SUCCESS(urUSMPoolRetain(pool));
+    uint32_t refCount = 0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_REFERENCE_COUNT,
+                                    sizeof(refCount), &refCount, nullptr));
+    EXPECT_EQ(refCount, 2u);
+    ASSERT_SUCCESS(urUSMPoolRelease(pool));
+
+    ur_context_handle_t poolContext = nullptr;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_CONTEXT,
+                                    sizeof(poolContext), &poolContext,
+                                    nullptr));
+    EXPECT_EQ(poolContext, context);
+}
+
+TEST_P(urNativeCpuUSMPoolTest, AllocationsBelongToPool) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMSharedAlloc(context, device, nullptr, pool, 1024, &ptr));
+    auto *bytes = static_cast<unsigned char *>(ptr);
+    for (size_t i = 0; i < 1024; i++) {
+        ASSERT_EQ(bytes[i], 0) << "index " << i;
+    }
+
+    ur_usm_pool_handle_t allocPool = nullptr;
+    ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, ptr, UR_USM_ALLOC_INFO_POOL,
+                                        sizeof(allocPool), &allocPool,
+                                        nullptr));
+    EXPECT_EQ(allocPool, pool);
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+}
@@ -0,0 +1,160 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "virtual_mem.hpp"
+
+#include <uur/fixtures.h>
+
+#include <cstdint>
+
+TEST(VirtualMemAccessMapTest, SplitsRanges) {
+    native_cpu::virtual_mem_access_map_t map;
+    const auto at = [](uintptr_t addr) {
+        return reinterpret_cast<const void *>(addr);
+    };
+    map.set(at(0x1000), 0x4000, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    map.set(at(0x2000), 0x1000, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY);
+    EXPECT_EQ(map.find(at(0x1000)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(map.find(at(0x2fff)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY);
+    EXPECT_EQ(map.find(at(0x3000)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(map.find(at(0x4fff)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(map.find(at(0x5000)), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+    EXPECT_EQ(map.find(at(0x0fff)), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+
+    // Erasing across ranges keeps what lies outside
+    map.erase(at(0x2800), 0x1000);
+    EXPECT_EQ(map.find(at(0x27ff)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY);
+    EXPECT_EQ(map.find(at(0x2800)), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+    EXPECT_EQ(map.find(at(0x37ff)), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+    EXPECT_EQ(map.find(at(0x3800)), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    map.erase(at(0), 0x10000);
+    EXPECT_EQ(map.find(at(0x1000)), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+}
+
+struct urNativeCpuVirtualMemTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::SetUp());
+        ur_bool_t supported = false;
+        ASSERT_SUCCESS(urDeviceGetInfo(device,
+                                       UR_DEVICE_INFO_VIRTUAL_MEMORY_SUPPORT,
+                                       sizeof(supported), &supported, nullptr));
+        if (!supported) {
+            GTEST_SKIP() << "Virtual memory is not supported";
+        }
+        ASSERT_SUCCESS(urVirtualMemGranularityGetInfo(
+            context, device, UR_VIRTUAL_MEM_GRANULARITY_INFO_MINIMUM,
+            sizeof(granularity), &granularity, nullptr));
+        ASSERT_SUCCESS(urVirtualMemReserve(context, nullptr,
+                                           numPages * granularity, &start));
+    }
+
+    void TearDown() override {
+        if (start) {
+            EXPECT_SUCCESS(
+                urVirtualMemFree(context, start, numPages * granularity));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urContextTest::TearDown());
+    }
+
+    uint8_t *page(size_t index) {
+        return static_cast<uint8_t *>(start) + index * granularity;
+    }
+
+    ur_virtual_mem_access_flags_t access(size_t index) {
+        ur_virtual_mem_access_flags_t flags = 0;
+        EXPECT_SUCCESS(urVirtualMemGetInfo(context, page(index), granularity,
+                                           UR_VIRTUAL_MEM_INFO_ACCESS_MODE,
+                                           sizeof(flags), &flags, nullptr));
+        return flags;
+    }
+
+    static constexpr size_t numPages = 16;
+    size_t granularity = 0;
+    void *start = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urNativeCpuVirtualMemTest);
+
+TEST_P(urNativeCpuVirtualMemTest, GrowsInPlace) {
+    // Physical memory mapped piece by piece behind the same reservation
+    ur_physical_mem_handle_t first = nullptr, second = nullptr;
+    ASSERT_SUCCESS(urPhysicalMemCreate(context, device, 4 * granularity,
+                                       nullptr, &first));
+    ASSERT_SUCCESS(urPhysicalMemCreate(context, device, 4 * granularity,
+                                       nullptr, &second));
+    ASSERT_SUCCESS(urVirtualMemMap(context, page(0), 4 * granularity, first,
+                                   0, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    for (size_t i = 0; i < 4 * granularity; i++) {
+        page(0)[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_SUCCESS(urVirtualMemMap(context, page(4), 4 * granularity, second,
+                                   0, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    for (size_t i = 4 * granularity; i < 8 * granularity; i++) {
+        page(0)[i] = static_cast<uint8_t>(i);
+    }
+    for (size_t i = 0; i < 8 * granularity; i++) {
+        ASSERT_EQ(page(0)[i], static_cast<uint8_t>(i)) << "index " << i;
+    }
+    EXPECT_EQ(access(7), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(access(8), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+
+    ASSERT_SUCCESS(urVirtualMemUnmap(context, page(0), 8 * granularity));
+    EXPECT_EQ(access(0), UR_VIRTUAL_MEM_ACCESS_FLAG_NONE);
+    ASSERT_SUCCESS(urPhysicalMemRelease(first));
+    ASSERT_SUCCESS(urPhysicalMemRelease(second));
+}
+
+TEST_P(urNativeCpuVirtualMemTest, PhysicalMemIsShared) {
+    ur_physical_mem_handle_t physical = nullptr;
+    ASSERT_SUCCESS(urPhysicalMemCreate(context, device, 2 * granularity,
+                                       nullptr, &physical));
+    // The same physical page at two addresses, at an offset in the memory
+    ASSERT_SUCCESS(urVirtualMemMap(context, page(0), granularity, physical,
+                                   granularity,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    ASSERT_SUCCESS(urVirtualMemMap(context, page(8), granularity, physical,
+                                   granularity,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    // Mappings keep the memory alive
+    ASSERT_SUCCESS(urPhysicalMemRelease(physical));
+    page(0)[42] = 42;
+    EXPECT_EQ(page(8)[42], 42);
+    ASSERT_SUCCESS(urVirtualMemUnmap(context, page(0), granularity));
+    ASSERT_SUCCESS(urVirtualMemUnmap(context, page(8), granularity));
+}
+
+TEST_P(urNativeCpuVirtualMemTest, SetAccess) {
+    ur_physical_mem_handle_t physical = nullptr;
+    ASSERT_SUCCESS(urPhysicalMemCreate(context, device, 3 * granularity,
+                                       nullptr, &physical));
+    ASSERT_SUCCESS(urVirtualMemMap(context, page(0), 3 * granularity, physical,
+                                   0, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    page(1)[0] = 7;
+    ASSERT_SUCCESS(urVirtualMemSetAccess(context, page(1), granularity,
+                                         UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY));
+    EXPECT_EQ(access(0), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(access(1), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY);
+    EXPECT_EQ(access(2), UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    EXPECT_EQ(page(1)[0], 7);
+    page(2)[0] = 8;
+
+    ASSERT_SUCCESS(urVirtualMemUnmap(context, page(0), 3 * granularity));
+    ASSERT_SUCCESS(urPhysicalMemRelease(physical));
+}
+
+TEST_P(urNativeCpuVirtualMemTest, InvalidArguments) {
+    ur_physical_mem_handle_t physical = nullptr;
+    EXPECT_EQ(urPhysicalMemCreate(context, device, granularity + 1, nullptr,
+                                  &physical),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_SUCCESS(urPhysicalMemCreate(context, device, granularity, nullptr,
+                                       &physical));
+    EXPECT_EQ(urVirtualMemMap(context, page(0), 2 * granularity, physical, 0,
+                              UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    EXPECT_EQ(urVirtualMemMap(context, page(0), granularity, physical, 0,
+                              UR_VIRTUAL_MEM_ACCESS_FLAG_FORCE_UINT32),
+              UR_RESULT_ERROR_INVALID_ENUMERATION);
+    ASSERT_SUCCESS(urPhysicalMemRelease(physical));
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how long a task scheduled to an idle thread pool takes to start
+// running, under each of the worker wait policies. Tasks are scheduled one at
+// a time with a gap in between, which decides whether the workers are still
+// spinning or already parked when the next task arrives.
+
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t numSamples = 2000;
+
+// Yields rather than sleeping, as sleeping would overshoot short gaps
+void waitFor(std::chrono::nanoseconds gap) {
+    const auto until = clock_type::now() + gap;
+    while (clock_type::now() < until) {
+        std::this_thread::yield();
+    }
+}
+
+// Launch-to-start latencies in nanoseconds, sorted
+template <typename PoolT>
+std::vector<double> measure(PoolT &pool, std::chrono::nanoseconds gap) {
+    std::vector<double> latencies;
+    latencies.reserve(numSamples);
+    for (size_t i = 0; i < numSamples; i++) {
+        waitFor(gap);
+        std::atomic<bool> started{false};
+        clock_type::time_point start;
+        const auto scheduled = clock_type::now();
+        pool.schedule([&](size_t) {
+            start = clock_type::now();
+            started.store(true, std::memory_order_release);
+        });
+        while (!started.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        latencies.push_back(
+            std::chrono::duration<double, std::nano>(start - scheduled)
+                .count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+double percentile(const std::vector<double> &sorted, double p) {
+    return sorted[static_cast<size_t>(p * (sorted.size() - 1))];
+}
+
+template <typename PoolT> void benchPool(const char *name) {
+    using native_cpu::detail::wait_policy_t;
+    const std::pair<const char *, wait_policy_t::mode_t> modes[] = {
+        {"park", wait_policy_t::mode_t::park},
+        {"spin", wait_policy_t::mode_t::spin},
+        {"adaptive", wait_policy_t::mode_t::adaptive}};
+    for (auto [modeName, mode] : modes) {
+        wait_policy_t policy = wait_policy_t::from_environment();
+        policy.mode = mode;
+        PoolT pool(native_cpu::worker_placement_t::from_environment(
+                       native_cpu::detail::get_num_threads()),
+                   policy);
+        for (auto gap : {std::chrono::microseconds(0),
+                         std::chrono::microseconds(20),
+                         std::chrono::microseconds(200)}) {
+            auto latencies = measure(pool, gap);
+            std::printf("%-14s %-9s gap=%-4lldus p50=%8.0fns p90=%8.0fns "
+                        "p99=%8.0fns\n",
+                        name, modeName, static_cast<long long>(gap.count()),
+                        percentile(latencies, 0.5), percentile(latencies, 0.9),
+                        percentile(latencies, 0.99));
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    benchPool<native_cpu::detail::simple_thread_pool>("simple");
+    benchPool<native_cpu::detail::work_stealing_thread_pool>("work_stealing");
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the cost of calling hot entry points through the loader's exported
+// functions with calling them through the tables returned by the loader's
+// urGet*ProcAddrTable functions. Run it with UR_ADAPTERS_FORCE_LOAD pointing
+// at the null adapter, and without UR_ENABLE_LOADER_INTERCEPT or any layers,
+// so that the tables hold the adapter's own entry points. Setting
+// UR_ENABLE_DIRECT_DISPATCH as well measures the exported functions in direct
+// dispatch mode.
+
+#include "ur_api.h"
+#include "ur_ddi.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+constexpr size_t callsPerEntryPoint = 2000000;
+
+#define CHECK(CALL)                                                            \
+    do {                                                                       \
+        ur_result_t result = CALL;                                             \
+        if (result != UR_RESULT_SUCCESS) {                                     \
+            std::fprintf(stderr, "%s failed: %d\n", #CALL, result);            \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+template <typename call_t> double measure(call_t call) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < callsPerEntryPoint; i++) {
+        CHECK(call());
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() * 1e9 / double(callsPerEntryPoint);
+}
+
+double exportedTotal = 0.0, tableTotal = 0.0;
+
+template <typename exported_t, typename table_t>
+void compare(const char *name, exported_t exported, table_t table) {
+    // Warm up both paths before timing them
+    measure(exported);
+    measure(table);
+    const double exportedNs = measure(exported);
+    const double tableNs = measure(table);
+    exportedTotal += exportedNs;
+    tableTotal += tableNs;
+    std::printf("%-32s %8.2f ns %8.2f ns\n", name, exportedNs, tableNs);
+}
+
+#define COMPARE(NAME, TABLE, ...)                                              \
+    compare(                                                                   \
+        #NAME, [&]() { return NAME(__VA_ARGS__); },                            \
+        [&]() { return TABLE(__VA_ARGS__); })
+
+} // namespace
+
+int main() {
+    if (std::getenv("UR_ENABLE_LOADER_INTERCEPT")) {
+        std::fprintf(stderr, "warning: UR_ENABLE_LOADER_INTERCEPT is set, "
+                             "tables hold the loader's intercepts\n");
+    }
+
+    CHECK(urLoaderInit(0, nullptr));
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue = nullptr;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+    const char il[] = "kernel";
+    ur_program_handle_t program = nullptr;
+    CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr, &program));
+    ur_kernel_handle_t kernel = nullptr;
+    CHECK(urKernelCreate(program, "kernel", &kernel));
+    ur_mem_handle_t buffer = nullptr;
+    CHECK(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 64, nullptr,
+                            &buffer));
+    ur_event_handle_t event = nullptr;
+    CHECK(urEnqueueEventsWait(queue, 0, nullptr, &event));
+
+    ur_enqueue_dditable_t enqueue = {};
+    CHECK(urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT, &enqueue));
+    ur_kernel_dditable_t kernelTable = {};
+    CHECK(urGetKernelProcAddrTable(UR_API_VERSION_CURRENT, &kernelTable));
+    ur_event_dditable_t eventTable = {};
+    CHECK(urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &eventTable));
+    ur_queue_dditable_t queueTable = {};
+    CHECK(urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &queueTable));
+
+    const size_t offset = 0, size = 1;
+    char host[64] = {};
+    const int pattern = 0;
+    ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+
+    std::printf("%-32s %11s %11s\n", "entry point", "exported", "table");
+    COMPARE(urEnqueueKernelLaunch, enqueue.pfnKernelLaunch, queue, kernel, 1,
+            &offset, &size, nullptr, 0, nullptr, nullptr);
+    COMPARE(urEnqueueEventsWait, enqueue.pfnEventsWait, queue, 1, &event,
+            nullptr);
+    COMPARE(urEnqueueEventsWaitWithBarrier, enqueue.pfnEventsWaitWithBarrier,
+            queue, 1, &event, nullptr);
+    COMPARE(urEnqueueMemBufferRead, enqueue.pfnMemBufferRead, queue, buffer,
+            false, 0, sizeof(host), host, 0, nullptr, nullptr);
+    COMPARE(urEnqueueMemBufferWrite, enqueue.pfnMemBufferWrite, queue, buffer,
+            false, 0, sizeof(host), host, 0, nullptr, nullptr);
+    COMPARE(urEnqueueMemBufferCopy, enqueue.pfnMemBufferCopy, queue, buffer,
+            buffer, 0, 32, 32, 0, nullptr, nullptr);
+    COMPARE(urEnqueueMemBufferFill, enqueue.pfnMemBufferFill, queue, buffer,
+            &pattern, sizeof(pattern), 0, sizeof(host), 0, nullptr, nullptr);
+    COMPARE(urEnqueueUSMFill, enqueue.pfnUSMFill, queue, host, sizeof(pattern),
+            &pattern, sizeof(host), 0, nullptr, nullptr);
+    COMPARE(urEnqueueUSMMemcpy, enqueue.pfnUSMMemcpy, queue, false, host,
+            host + 32, 32, 0, nullptr, nullptr);
+    COMPARE(urEnqueueUSMPrefetch, enqueue.pfnUSMPrefetch, queue, host,
+            sizeof(host), 0, 0, nullptr, nullptr);
+    COMPARE(urKernelSetArgValue, kernelTable.pfnSetArgValue, kernel, 0,
+            sizeof(pattern), nullptr, &pattern);
+    COMPARE(urKernelSetArgPointer, kernelTable.pfnSetArgPointer, kernel, 0,
+            nullptr, host);
+    COMPARE(urKernelSetArgMemObj, kernelTable.pfnSetArgMemObj, kernel, 0,
+            nullptr, buffer);
+    COMPARE(urKernelRetain, kernelTable.pfnRetain, kernel);
+    COMPARE(urKernelRelease, kernelTable.pfnRelease, kernel);
+    COMPARE(urEventRetain, eventTable.pfnRetain, event);
+    COMPARE(urEventRelease, eventTable.pfnRelease, event);
+    COMPARE(urEventWait, eventTable.pfnWait, 1, &event);
+    COMPARE(urEventGetInfo, eventTable.pfnGetInfo, event,
+            UR_EVENT_INFO_COMMAND_EXECUTION_STATUS, sizeof(status), &status,
+            nullptr);
+    COMPARE(urQueueFlush, queueTable.pfnFlush, queue);
+    std::printf("%-32s %8.2f ns %8.2f ns\n", "total", exportedTotal,
+                tableTotal);
+
+    CHECK(urEventRelease(event));
+    CHECK(urMemRelease(buffer));
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urQueueRelease(queue));
+    CHECK(urContextRelease(context));
+    CHECK(urDeviceRelease(device));
+    CHECK(urAdapterRelease(adapter));
+    CHECK(urLoaderTearDown());
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_api.h"
+#include "ur_ddi.h"
+#include <gtest/gtest.h>
+
+#ifndef ASSERT_SUCCESS
+#define ASSERT_SUCCESS(ACTUAL) ASSERT_EQ(UR_RESULT_SUCCESS, ACTUAL)
+#endif
+
+// The loader is only initialized once per process, so each of these tests is
+// run on its own, see CMakeLists.txt
+
+TEST(LoaderDispatchTest, WithoutLayers) {
+    ASSERT_SUCCESS(urLoaderInit(0, nullptr));
+
+    ur_adapter_handle_t adapter = nullptr;
+    ASSERT_SUCCESS(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    ASSERT_SUCCESS(
+        urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+
+    ur_context_dditable_t contextTable = {};
+    ASSERT_SUCCESS(
+        urGetContextProcAddrTable(UR_API_VERSION_CURRENT, &contextTable));
+    ur_queue_dditable_t queueTable = {};
+    ASSERT_SUCCESS(
+        urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &queueTable));
+    ur_enqueue_dditable_t enqueueTable = {};
+    ASSERT_SUCCESS(
+        urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT, &enqueueTable));
+    ur_event_dditable_t eventTable = {};
+    ASSERT_SUCCESS(
+        urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &eventTable));
+
+    // The table doesn't lead back into the exported functions
+    ASSERT_NE(enqueueTable.pfnEventsWait, nullptr);
+    ASSERT_NE(enqueueTable.pfnEventsWait, &urEnqueueEventsWait);
+
+    // Handles from the table and the exported functions are interchangeable
+    ur_context_handle_t context = nullptr;
+    ASSERT_SUCCESS(contextTable.pfnCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(enqueueTable.pfnEventsWait(queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(eventTable.pfnRelease(event));
+    ASSERT_SUCCESS(queueTable.pfnFinish(queue));
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    ASSERT_SUCCESS(urContextRelease(context));
+
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    ASSERT_SUCCESS(urAdapterRelease(adapter));
+    ASSERT_SUCCESS(urLoaderTearDown());
+}
+
+TEST(LoaderDispatchTest, WithLayers) {
+    ur_loader_config_handle_t config = nullptr;
+    ASSERT_SUCCESS(urLoaderConfigCreate(&config));
+    ASSERT_SUCCESS(
+        urLoaderConfigEnableLayer(config, "UR_LAYER_PARAMETER_VALIDATION"));
+    ASSERT_SUCCESS(urLoaderInit(0, config));
+    ASSERT_SUCCESS(urLoaderConfigRelease(config));
+
+    // Calls through the table still go through the enabled layers
+    ur_enqueue_dditable_t enqueueTable = {};
+    ASSERT_SUCCESS(
+        urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT, &enqueueTable));
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+              enqueueTable.pfnEventsWait(nullptr, 0, nullptr, &event));
+
+    ASSERT_SUCCESS(urLoaderTearDown());
+}
+
+TEST(LoaderDispatchTest, DirectDispatch) {
+    ASSERT_SUCCESS(urLoaderInit(0, nullptr));
+
+    // The exported functions reach the adapter
+    ur_adapter_handle_t adapter = nullptr;
+    ASSERT_SUCCESS(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    ASSERT_SUCCESS(
+        urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+    ur_queue_handle_t queue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(urEventRelease(event));
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    ASSERT_SUCCESS(urContextRelease(context));
+
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    ASSERT_SUCCESS(urAdapterRelease(adapter));
+    ASSERT_SUCCESS(urLoaderTearDown());
+}
+
+TEST(LoaderDispatchTest, DirectDispatchWithLayers) {
+    ur_loader_config_handle_t config = nullptr;
+    ASSERT_SUCCESS(urLoaderConfigCreate(&config));
+    ASSERT_SUCCESS(
+        urLoaderConfigEnableLayer(config, "UR_LAYER_PARAMETER_VALIDATION"));
+    ASSERT_SUCCESS(urLoaderInit(0, config));
+    ASSERT_SUCCESS(urLoaderConfigRelease(config));
+
+    // Calls still go through the enabled layers
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+              urEnqueueEventsWait(nullptr, 0, nullptr, &event));
+
+    ASSERT_SUCCESS(urLoaderTearDown());
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the throughput of urEnqueueKernelLaunch returning an event, which
+// is released straight away, with several threads submitting at once. Run it
+// with UR_ENABLE_LOADER_INTERCEPT=1 and UR_ADAPTERS_FORCE_LOAD pointing at the
+// null adapter, so that the time measured is spent translating handles in the
+// loader.
+
+#include "ur_api.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t launchesPerThread = 200000;
+
+#define CHECK(CALL)                                                            \
+    do {                                                                       \
+        ur_result_t result = CALL;                                             \
+        if (result != UR_RESULT_SUCCESS) {                                     \
+            std::fprintf(stderr, "%s failed: %d\n", #CALL, result);            \
+            std::exit(1);                                                      \
+        }                                                                      \
+    } while (0)
+
+void submit(ur_context_handle_t context, ur_device_handle_t device,
+            ur_kernel_handle_t kernel) {
+    ur_queue_handle_t queue = nullptr;
+    CHECK(urQueueCreate(context, device, nullptr, &queue));
+    const size_t offset = 0, size = 1;
+    for (size_t i = 0; i < launchesPerThread; i++) {
+        ur_event_handle_t event = nullptr;
+        CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size, nullptr,
+                                    0, nullptr, &event));
+        CHECK(urEventRelease(event));
+    }
+    CHECK(urQueueRelease(queue));
+}
+
+} // namespace
+
+int main() {
+    if (!std::getenv("UR_ENABLE_LOADER_INTERCEPT")) {
+        std::fprintf(stderr, "warning: UR_ENABLE_LOADER_INTERCEPT isn't set, "
+                             "calls may bypass the loader\n");
+    }
+
+    CHECK(urLoaderInit(0, nullptr));
+    ur_adapter_handle_t adapter = nullptr;
+    CHECK(urAdapterGet(1, &adapter, nullptr));
+    ur_platform_handle_t platform = nullptr;
+    CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+    ur_device_handle_t device = nullptr;
+    CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    ur_context_handle_t context = nullptr;
+    CHECK(urContextCreate(1, &device, nullptr, &context));
+    const char il[] = "kernel";
+    ur_program_handle_t program = nullptr;
+    CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr, &program));
+    ur_kernel_handle_t kernel = nullptr;
+    CHECK(urKernelCreate(program, "kernel", &kernel));
+
+    for (size_t numThreads : {1, 2, 4, 8}) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; i++) {
+            threads.emplace_back(submit, context, device, kernel);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        const double launches = double(numThreads * launchesPerThread);
+        std::printf("threads=%zu %8.1f ns/launch %8.2f Mlaunches/s\n",
+                    numThreads, elapsed.count() * 1e9 / launches,
+                    launches / elapsed.count() / 1e6);
+    }
+
+    CHECK(urKernelRelease(kernel));
+    CHECK(urProgramRelease(program));
+    CHECK(urContextRelease(context));
+    CHECK(urDeviceRelease(device));
+    CHECK(urAdapterRelease(adapter));
+    CHECK(urLoaderTearDown());
+    return 0;
+}
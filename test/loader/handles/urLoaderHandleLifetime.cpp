@@ -0,0 +1,121 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+#include "ur_api.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unordered_set>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+struct LoaderHandleLifetimeTest : LoaderHandleTest {
+    void SetUp() override {
+        LoaderHandleTest::SetUp();
+        ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    }
+
+    void TearDown() override {
+        urQueueRelease(queue);
+        urContextRelease(context);
+        LoaderHandleTest::TearDown();
+    }
+
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+};
+
+// Resident set size in bytes, or 0 if it can't be read
+static size_t getResidentSetSize() {
+#if defined(__linux__)
+    size_t pages = 0, residentPages = 0;
+    std::ifstream statm("/proc/self/statm");
+    if (statm >> pages >> residentPages) {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+TEST_F(LoaderHandleLifetimeTest, ReleasesLastReference) {
+    ur_event_handle_t retained = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &retained));
+    ASSERT_SUCCESS(urEventRetain(retained));
+    ASSERT_SUCCESS(urEventRelease(retained));
+
+    // Released handles are reused, whereas the retained one is left alone
+    constexpr size_t numEvents = 100000;
+    std::unordered_set<ur_event_handle_t> handles;
+    for (size_t i = 0; i < numEvents; ++i) {
+        ur_event_handle_t event = nullptr;
+        ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+        ASSERT_NE(event, retained);
+        handles.insert(event);
+        ASSERT_SUCCESS(urEventRelease(event));
+    }
+    EXPECT_LT(handles.size(), numEvents / 10);
+
+    ur_native_handle_t native = 0;
+    ASSERT_SUCCESS(urEventGetNativeHandle(retained, &native));
+    ASSERT_SUCCESS(urEventRelease(retained));
+}
+
+TEST_F(LoaderHandleLifetimeTest, RootDeviceOutlivesRelease) {
+    // Releasing a root device leaves its reference count unchanged, so
+    // unpaired releases mustn't free its handle
+    ASSERT_SUCCESS(urDeviceRelease(device));
+    ASSERT_SUCCESS(urDeviceRelease(device));
+
+    // Sub-devices are counted, and their released handles would reuse the
+    // root device's had it been freed
+    const ur_device_partition_property_t property = {
+        UR_DEVICE_PARTITION_EQUALLY, {1}};
+    const ur_device_partition_properties_t properties = {
+        UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr, &property, 1};
+    for (size_t i = 0; i < 10000; ++i) {
+        ur_device_handle_t subDevice = nullptr;
+        ASSERT_SUCCESS(
+            urDevicePartition(device, &properties, 1, &subDevice, nullptr));
+        ASSERT_NE(subDevice, device);
+        ASSERT_SUCCESS(urDeviceRetain(subDevice));
+        ASSERT_SUCCESS(urDeviceRelease(subDevice));
+        ASSERT_SUCCESS(urDeviceRelease(subDevice));
+    }
+
+    ur_device_type_t type = UR_DEVICE_TYPE_ALL;
+    ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_TYPE, sizeof(type),
+                                   &type, nullptr));
+    ASSERT_SUCCESS(urDeviceRetain(device));
+}
+
+TEST_F(LoaderHandleLifetimeTest, SoakEvents) {
+    constexpr size_t warmupEvents = 100000;
+    constexpr size_t numEvents = 10000000;
+
+    auto createAndRelease = [this](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            ur_event_handle_t event = nullptr;
+            ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+            ASSERT_SUCCESS(urEventRelease(event));
+        }
+    };
+
+    createAndRelease(warmupEvents);
+    const size_t before = getResidentSetSize();
+    if (before == 0) {
+        GTEST_SKIP() << "resident set size isn't available";
+    }
+    createAndRelease(numEvents);
+    const size_t after = getResidentSetSize();
+
+    // Leaking a wrapper per event would take hundreds of megabytes
+    EXPECT_LT(after, before + 16 * 1024 * 1024)
+        << "before: " << before << " after: " << after;
+}
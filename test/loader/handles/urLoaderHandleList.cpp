@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_object.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+
+using event_list_t = handle_list_t<ur_event_handle_t>;
+
+static ur_event_handle_t makeEvent(uintptr_t value) {
+    return reinterpret_cast<ur_event_handle_t>(value);
+}
+
+TEST(LoaderHandleListTest, Empty) {
+    auto list = event_list_t(0);
+    ASSERT_EQ(list.data(), nullptr);
+}
+
+TEST(LoaderHandleListTest, HoldsHandles) {
+    for (size_t size : {size_t{1}, event_list_t::inlineSize,
+                        event_list_t::inlineSize + 1, size_t{1000}}) {
+        auto list = event_list_t(size);
+        for (size_t i = 0; i < size; ++i) {
+            list[i] = makeEvent(i + 1);
+        }
+        ur_event_handle_t *data = list.data();
+        ASSERT_NE(data, nullptr);
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(data[i], makeEvent(i + 1)) << size;
+        }
+    }
+}
+
+TEST(LoaderHandleListTest, ReusesScratchBuffer) {
+    const size_t size = event_list_t::inlineSize * 4;
+    ur_event_handle_t *first = nullptr;
+    {
+        auto list = event_list_t(size);
+        first = list.data();
+    }
+    auto list = event_list_t(size / 2);
+    ASSERT_EQ(list.data(), first);
+
+    // Another list at the same time can't share the buffer
+    auto other = event_list_t(size);
+    ASSERT_NE(other.data(), first);
+    other[size - 1] = makeEvent(1);
+    list[size / 2 - 1] = makeEvent(2);
+    ASSERT_EQ(other.data()[size - 1], makeEvent(1));
+
+    // Nor can another thread
+    std::thread([&]() {
+        auto threadList = event_list_t(size);
+        ASSERT_NE(threadList.data(), first);
+    }).join();
+}
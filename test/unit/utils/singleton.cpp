@@ -0,0 +1,120 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ur_singleton.hpp"
+
+namespace {
+
+struct handle_t;
+
+struct object_t {
+    object_t(handle_t *handle, int value) : handle(handle), value(value) {}
+    handle_t *handle;
+    int value;
+};
+
+using factory_t = singleton_factory_t<object_t, handle_t *>;
+
+handle_t *makeHandle(uintptr_t value) {
+    return reinterpret_cast<handle_t *>(value);
+}
+
+} // namespace
+
+TEST(SingletonFactory, SameInstanceForKey) {
+    factory_t factory;
+    object_t *first = factory.getInstance(makeHandle(0x10), 1);
+    object_t *second = factory.getInstance(makeHandle(0x10), 2);
+    ASSERT_EQ(first, second);
+    EXPECT_EQ(first->value, 1);
+    EXPECT_EQ(factory.getBorrowedInstance(makeHandle(0x10), 3), first);
+    EXPECT_NE(factory.getInstance(makeHandle(0x20), 4), first);
+    EXPECT_EQ(factory.getInstance(nullptr, 5), nullptr);
+}
+
+TEST(SingletonFactory, ReleasesWithLastReference) {
+    factory_t factory;
+    object_t *instance = factory.getInstance(makeHandle(0x10), 1);
+    factory.retain(makeHandle(0x10));
+    factory.release(makeHandle(0x10));
+    EXPECT_EQ(factory.getBorrowedInstance(makeHandle(0x10), 2)->value, 1);
+
+    factory.release(makeHandle(0x10));
+    instance = factory.getInstance(makeHandle(0x10), 3);
+    EXPECT_EQ(instance->value, 3);
+
+    // Releasing a key without an instance does nothing
+    factory.release(makeHandle(0x30));
+}
+
+TEST(SingletonFactory, PinnedIgnoresReferences) {
+    factory_t factory;
+    object_t *pinned = factory.getPinnedInstance(makeHandle(0x10), 1);
+    factory.release(makeHandle(0x10));
+    factory.release(makeHandle(0x10));
+    factory.retain(makeHandle(0x10));
+    EXPECT_EQ(factory.getInstance(makeHandle(0x10), 2), pinned);
+    factory.release(makeHandle(0x10));
+    EXPECT_EQ(pinned->value, 1);
+}
+
+TEST(SingletonFactory, BorrowedKeepsReferences) {
+    factory_t factory;
+
+    // Borrowing a counted instance doesn't change when it is released
+    object_t *counted = factory.getInstance(makeHandle(0x10), 1);
+    EXPECT_EQ(factory.getBorrowedInstance(makeHandle(0x10), 2), counted);
+    factory.release(makeHandle(0x10));
+    EXPECT_EQ(factory.getInstance(makeHandle(0x10), 3)->value, 3);
+
+    // Whereas an instance created by borrowing is owned by the factory
+    object_t *borrowed = factory.getBorrowedInstance(makeHandle(0x20), 4);
+    factory.release(makeHandle(0x20));
+    EXPECT_EQ(factory.getBorrowedInstance(makeHandle(0x20), 5), borrowed);
+    EXPECT_EQ(borrowed->value, 4);
+}
+
+TEST(SingletonFactory, ConcurrentThreads) {
+    constexpr size_t numThreads = 8;
+    constexpr size_t numIterations = 20000;
+    factory_t factory;
+    object_t *shared = factory.getInstance(makeHandle(0x8), 0);
+
+    std::vector<std::thread> threads;
+    std::vector<size_t> mismatches(numThreads);
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < numIterations; i++) {
+                // Keys of this thread, created and released over and over
+                auto handle = makeHandle(((t * numIterations + i) + 1) << 4);
+                object_t *instance =
+                    factory.getInstance(handle, static_cast<int>(i));
+                mismatches[t] += instance->handle != handle;
+                factory.release(handle);
+
+                // Along with a key all threads share
+                factory.retain(makeHandle(0x8));
+                mismatches[t] +=
+                    factory.getBorrowedInstance(makeHandle(0x8), 1) != shared;
+                factory.release(makeHandle(0x8));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < numThreads; t++) {
+        EXPECT_EQ(mismatches[t], 0u) << t;
+    }
+    EXPECT_EQ(factory.getBorrowedInstance(makeHandle(0x8), 1), shared);
+    EXPECT_EQ(shared->value, 0);
+}